@@ -1,19 +1,27 @@
 #ifndef INT_HPP
 #define INT_HPP
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "digits.h"
 #include "exceptions.h"
+#include "small_vector.h"
 #include "utils.h"
 
 namespace cppbuiltins {
@@ -47,20 +55,24 @@ class BigInt {
   using DoubleDigit = DoublePrecisionOf<Digit>;
   static_assert(!std::is_same<DoubleDigit, undefined>(),
                 "Double precision version of digit type is undefined.");
-  static_assert(std::is_integral<DoubleDigit>(),
+  static_assert(std::numeric_limits<DoubleDigit>::is_integer,
                 "Double precision digit should be integral.");
   static_assert(std::numeric_limits<DoubleDigit>::digits >= 2 * BINARY_SHIFT,
                 "Double precision digit should be able to hold all integers "
                 "lesser than squared base.");
-  using SignedDoubleDigit = typename std::make_signed<DoubleDigit>::type;
+  using SignedDoubleDigit = SignedOf<DoubleDigit>;
 
-  static constexpr Digit BINARY_BASE = 1 << BINARY_SHIFT;
+  static constexpr Digit BINARY_BASE = Digit(1) << BINARY_SHIFT;
   static constexpr Digit BINARY_DIGIT_MASK = BINARY_BASE - 1;
 
+  static constexpr std::size_t INLINE_DIGITS_COUNT =
+      2 * sizeof(std::uint64_t) / sizeof(Digit);
+  using Digits = SmallVector<Digit, INLINE_DIGITS_COUNT>;
+
   BigInt() : _sign(0), _digits({0}) {}
 
   template <class T,
-            std::enable_if_t<std::is_unsigned_v<T> &&
+            std::enable_if_t<!std::numeric_limits<T>::is_signed &&
                                  cppbuiltins::is_upcastable_v<T, Digit>,
                              int> = 0>
   explicit BigInt(T value) {
@@ -69,7 +81,7 @@ class BigInt {
       _digits = {0};
     } else {
       _sign = 1;
-      Digit remainder = value >> BINARY_SHIFT;
+      Digit remainder = static_cast<Digit>(value) >> BINARY_SHIFT;
       if (remainder) {
         _digits.push_back(value & BINARY_DIGIT_MASK);
         _digits.push_back(remainder);
@@ -79,9 +91,8 @@ class BigInt {
   }
 
   template <class T,
-            std::enable_if_t<std::is_unsigned_v<T> &&
-                                 !cppbuiltins::is_upcastable_v<T, Digit> &&
-                                 cppbuiltins::is_upcastable_v<T, DoubleDigit>,
+            std::enable_if_t<!std::numeric_limits<T>::is_signed &&
+                                 !cppbuiltins::is_upcastable_v<T, Digit>,
                              int> = 0>
   explicit BigInt(T value) {
     if (value == 0) {
@@ -97,7 +108,7 @@ class BigInt {
   }
 
   template <class T,
-            std::enable_if_t<std::is_signed_v<T> &&
+            std::enable_if_t<std::numeric_limits<T>::is_signed &&
                                  cppbuiltins::is_upcastable_v<T, SignedDigit>,
                              int> = 0>
   explicit BigInt(T value) {
@@ -118,7 +129,7 @@ class BigInt {
   }
 
   template <class T, std::enable_if_t<
-                         std::is_signed_v<T> &&
+                         std::numeric_limits<T>::is_signed &&
                              !cppbuiltins::is_upcastable_v<T, SignedDigit> &&
                              cppbuiltins::is_upcastable_v<T, SignedDoubleDigit>,
                          int> = 0>
@@ -142,6 +153,17 @@ class BigInt {
     }
   }
 
+  template <
+      class T,
+      std::enable_if_t<std::numeric_limits<T>::is_signed &&
+                           !cppbuiltins::is_upcastable_v<T, SignedDoubleDigit>,
+                       int> = 0>
+  explicit BigInt(T value)
+      : BigInt(value < 0 ? static_cast<std::make_unsigned_t<T>>(-1 - value) + 1
+                         : static_cast<std::make_unsigned_t<T>>(value)) {
+    if (value < 0) _sign = -1;
+  }
+
   explicit BigInt(const char* const characters, std::size_t base = 10) {
     if ((base != 0 && base < 2) || base > MAX_REPRESENTABLE_BASE)
       throw std::invalid_argument(
@@ -155,7 +177,16 @@ class BigInt {
       _sign = -1;
       ++start;
     }
-    _digits = parse_binary_digits<Digit, SEPARATOR, BINARY_SHIFT>(start, base);
+    const std::vector<unsigned char> digits =
+        parse_base_digits<SEPARATOR>(start, base);
+    if (base & (base - 1))
+      _digits = from_non_binary_base_digits(digits, 0, digits.size(), base);
+    else {
+      const std::vector<Digit> binary_digits =
+          binary_digits_from_binary_base<Digit, BINARY_SHIFT>(digits,
+                                                              floor_log2(base));
+      _digits.assign(binary_digits.begin(), binary_digits.end());
+    }
     _sign *= (_digits.size() > 1 || _digits[0] != 0);
   }
 
@@ -170,6 +201,20 @@ class BigInt {
                      BigInt(cppbuiltins::bit_length(_digits.back()));
   }
 
+  BigInt comb(const BigInt& count) const {
+    if (is_negative() || count.is_negative())
+      throw std::invalid_argument(
+          "Combinations count of negative numbers is undefined.");
+    if (count > *this) return BigInt();
+    const BigInt complement = *this - count;
+    const std::size_t count_value =
+        to_count(complement < count ? complement : count);
+    if (count_value >= BINOMIAL_SIEVE_CUTOFF &&
+        *this <= BigInt(count_value) * BINOMIAL_SIEVE_RATIO)
+      return binomial_by_primes(to_count(*this), count_value);
+    return falling_factorial<true>(count_value);
+  }
+
   template <class Result = double,
             std::enable_if_t<std::is_floating_point_v<Result>, int> = 0>
   Result divide_approximately(const BigInt& divisor) const {
@@ -181,8 +226,8 @@ class BigInt {
     if (!divisor) throw ZeroDivisionError();
     bool negate = is_negative() ^ divisor.is_negative();
     if (!*this) return negate ? -0.0 : 0.0;
-    const std::vector<Digit>& dividend_digits = digits();
-    const std::vector<Digit>& divisor_digits = divisor.digits();
+    const Digits& dividend_digits = digits();
+    const Digits& divisor_digits = divisor.digits();
     std::size_t dividend_digits_count = dividend_digits.size();
     std::size_t divisor_digits_count = divisor_digits.size();
     bool dividend_is_small =
@@ -259,19 +304,19 @@ class BigInt {
       while (!inexact && shift_digits > 0)
         if (dividend_digits[--shift_digits]) inexact = true;
     }
-    std::vector<Digit> quotient_digits(quotient_data,
-                                       quotient_data + quotient_digits_count);
+    Digits quotient_digits(quotient_data,
+                           quotient_data + quotient_digits_count);
     trim_leading_zeros(quotient_digits);
     if (divisor_digits_count == 1) {
-      std::vector<Digit> next_quotient_digits;
+      Digits next_quotient_digits;
       Digit remainder = divrem_digits_by_digit(
           quotient_digits, divisor_digits[0], next_quotient_digits);
       std::swap(quotient_digits, next_quotient_digits);
       if (remainder) inexact = true;
     } else {
-      std::vector<Digit> next_quotient_digits, remainder;
-      divrem_two_or_more_digits(quotient_digits, divisor_digits,
-                                next_quotient_digits, remainder);
+      Digits next_quotient_digits, remainder;
+      divrem_digits(quotient_digits, divisor_digits, next_quotient_digits,
+                    remainder);
       std::swap(quotient_digits, next_quotient_digits);
       if (remainder.size() > 1 || remainder[0] != 0) inexact = true;
     }
@@ -300,6 +345,38 @@ class BigInt {
     return negate ? -result : result;
   }
 
+  BigInt divide_exact(const BigInt& divisor) const {
+    if (!divisor) throw ZeroDivisionError();
+    if (_digits.size() < divisor._digits.size()) return BigInt();
+    if (divisor._digits.size() > BURNIKEL_ZIEGLER_CUTOFF &&
+        _digits.size() - divisor._digits.size() > BURNIKEL_ZIEGLER_CUTOFF)
+      return floor_divide(divisor);
+    Digits digits = divide_digits_exact(_digits, divisor._digits);
+    return BigInt(_sign * divisor._sign * (digits.size() > 1 || digits[0] != 0),
+                  std::move(digits));
+  }
+
+  BigInt factorial() const {
+    if (is_negative())
+      throw std::invalid_argument("Factorial of negative number is undefined.");
+    const std::size_t value = to_count(*this);
+    BigInt inner(1), result(1);
+    std::size_t upper = 3;
+    for (std::size_t shift = cppbuiltins::bit_length(value); shift-- > 0;) {
+      const std::size_t step = value >> shift;
+      if (step <= 2) continue;
+      const std::size_t lower = upper;
+      upper = (step + 1) | 1;
+      inner *=
+          odd_range_product(lower, upper, cppbuiltins::bit_length(upper - 2));
+      result *= inner;
+    }
+    std::size_t two_exponent = 0;
+    for (std::size_t rest = value >> 1; rest; rest >>= 1) two_exponent += rest;
+    result <<= two_exponent;
+    return result;
+  }
+
   BigInt floor_divide(const BigInt& divisor) const {
     BigInt result;
     divmod<true, false>(divisor, &result, nullptr);
@@ -307,150 +384,175 @@ class BigInt {
   }
 
   BigInt gcd(const BigInt& other) const {
-    std::vector<Digit> largest_digits = _digits,
-                       smallest_digits = other._digits;
+    Digits largest_digits = _digits, smallest_digits = other._digits;
     if (digits_lesser_than(largest_digits, smallest_digits))
       std::swap(largest_digits, smallest_digits);
+    if (smallest_digits.size() > HALF_GCD_CUTOFF) {
+      BigInt largest(1, largest_digits), smallest(1, smallest_digits);
+      std::array<BigInt, 4> transform;
+      while (smallest._digits.size() > HALF_GCD_CUTOFF) {
+        if (smallest._digits.size() > largest._digits.size() / 2 + 1)
+          half_gcd(largest, smallest, transform);
+        else {
+          BigInt quotient, remainder;
+          largest.divmod(smallest, quotient, remainder);
+          largest = smallest;
+          smallest = remainder;
+        }
+      }
+      largest_digits = largest._digits;
+      smallest_digits = smallest._digits;
+    }
     for (std::size_t largest_digits_count;
          (largest_digits_count = largest_digits.size()) > 2;) {
       const std::size_t smallest_digits_count = smallest_digits.size();
       if (smallest_digits_count == 1 && smallest_digits[0] == 0)
-        return BigInt(1, largest_digits);
-      const std::size_t highest_digit_bit_length =
-          cppbuiltins::bit_length(largest_digits.back());
-      SignedDoubleDigit largest_leading_bits =
-          (static_cast<SignedDoubleDigit>(
-               largest_digits[largest_digits_count - 1])
-           << (2 * BINARY_SHIFT - highest_digit_bit_length)) |
-          (static_cast<SignedDoubleDigit>(
-               largest_digits[largest_digits_count - 2])
-           << (BINARY_SHIFT - highest_digit_bit_length)) |
-          static_cast<SignedDoubleDigit>(
-              largest_digits[largest_digits_count - 3] >>
-              highest_digit_bit_length);
-      SignedDoubleDigit smallest_leading_bits =
-          (smallest_digits_count >= largest_digits_count - 2
-               ? static_cast<SignedDoubleDigit>(
-                     smallest_digits[largest_digits_count - 3] >>
-                     highest_digit_bit_length)
-               : 0) |
-          (smallest_digits_count >= largest_digits_count - 1
-               ? static_cast<SignedDoubleDigit>(
-                     smallest_digits[largest_digits_count - 2])
-                     << (BINARY_SHIFT - highest_digit_bit_length)
-               : 0) |
-          (smallest_digits_count >= largest_digits_count
-               ? static_cast<SignedDoubleDigit>(
-                     smallest_digits[largest_digits_count - 1])
-                     << (2 * BINARY_SHIFT - highest_digit_bit_length)
-               : 0);
-      SignedDoubleDigit first_coefficient = 1, second_coefficient = 0,
-                        third_coefficient = 0, fourth_coefficient = 1;
-      std::size_t iterations_count = 0;
-      for (;; ++iterations_count) {
-        if (third_coefficient == smallest_leading_bits) break;
-        const SignedDoubleDigit scale =
-            (largest_leading_bits + (first_coefficient - 1)) /
-            (smallest_leading_bits - third_coefficient);
-        const SignedDoubleDigit next_third_coefficient =
-            second_coefficient + scale * fourth_coefficient;
-        const SignedDoubleDigit next_smallest_leading_bits =
-            largest_leading_bits - scale * smallest_leading_bits;
-        if (next_third_coefficient > next_smallest_leading_bits) break;
-        largest_leading_bits = smallest_leading_bits;
-        smallest_leading_bits = next_smallest_leading_bits;
-        const SignedDoubleDigit next_fourth_coefficient =
-            first_coefficient + scale * third_coefficient;
-        first_coefficient = fourth_coefficient;
-        second_coefficient = third_coefficient;
-        third_coefficient = next_third_coefficient;
-        fourth_coefficient = next_fourth_coefficient;
-      }
-      if (iterations_count == 0) {
+        return BigInt(1, std::move(largest_digits));
+      SignedDoubleDigit coefficients[4];
+      if (!lehmer_coefficients(largest_digits, smallest_digits, coefficients)) {
         if (smallest_digits_count == 1) {
-          std::vector<Digit> quotient;
+          Digits quotient;
           const Digit remainder = divrem_digits_by_digit(
               largest_digits, smallest_digits[0], quotient);
           largest_digits = smallest_digits;
-          smallest_digits = std::vector<Digit>({remainder});
+          smallest_digits = Digits({remainder});
         } else {
-          std::vector<Digit> quotient, remainder;
-          divrem_two_or_more_digits(largest_digits, smallest_digits, quotient,
-                                    remainder);
+          Digits quotient, remainder;
+          divrem_digits(largest_digits, smallest_digits, quotient, remainder);
           largest_digits = smallest_digits;
           smallest_digits = remainder;
         }
         continue;
       }
-      if (iterations_count & 1) {
-        first_coefficient = -first_coefficient;
-        second_coefficient = -second_coefficient;
-        third_coefficient = -third_coefficient;
-        fourth_coefficient = -fourth_coefficient;
-        std::swap(first_coefficient, second_coefficient);
-        std::swap(third_coefficient, fourth_coefficient);
-      }
-      SignedDoubleDigit next_largest_accumulator = 0;
-      SignedDoubleDigit next_smallest_accumulator = 0;
-      std::size_t index = 0;
-      std::vector<Digit> next_largest_digits, next_smallest_digits;
-      next_largest_digits.reserve(largest_digits_count);
-      next_smallest_digits.reserve(largest_digits_count);
-      for (; index < smallest_digits_count; ++index) {
-        next_largest_accumulator +=
-            (first_coefficient * largest_digits[index]) -
-            (second_coefficient * smallest_digits[index]);
-        next_smallest_accumulator +=
-            (fourth_coefficient * smallest_digits[index]) -
-            (third_coefficient * largest_digits[index]);
-        next_largest_digits.push_back(
-            static_cast<Digit>(next_largest_accumulator & BINARY_DIGIT_MASK));
-        next_smallest_digits.push_back(
-            static_cast<Digit>(next_smallest_accumulator & BINARY_DIGIT_MASK));
-        next_largest_accumulator >>= BINARY_SHIFT;
-        next_smallest_accumulator >>= BINARY_SHIFT;
-      }
-      for (; index < largest_digits_count; ++index) {
-        next_largest_accumulator += first_coefficient * largest_digits[index];
-        next_smallest_accumulator -= third_coefficient * largest_digits[index];
-        next_largest_digits.push_back(
-            static_cast<Digit>(next_largest_accumulator & BINARY_DIGIT_MASK));
-        next_smallest_digits.push_back(
-            static_cast<Digit>(next_smallest_accumulator & BINARY_DIGIT_MASK));
-        next_largest_accumulator >>= BINARY_SHIFT;
-        next_smallest_accumulator >>= BINARY_SHIFT;
-      }
-      trim_leading_zeros(next_largest_digits);
-      trim_leading_zeros(next_smallest_digits);
-      largest_digits = next_largest_digits;
-      smallest_digits = next_smallest_digits;
+      apply_lehmer_coefficients(coefficients, largest_digits, smallest_digits);
     }
     return BigInt(
         cppbuiltins::gcd(reduce_digits<DoubleDigit>(largest_digits),
                          reduce_digits<DoubleDigit>(smallest_digits)));
   }
 
+  BigInt xgcd(const BigInt& other, BigInt& first_coefficient,
+              BigInt& second_coefficient) const {
+    BigInt largest = abs(), smallest = other.abs();
+    const bool swapped = largest < smallest;
+    if (swapped) std::swap(largest, smallest);
+    std::array<BigInt, 4> transform{BigInt(1, {1}), BigInt(), BigInt(),
+                                    BigInt(1, {1})};
+    while (smallest._digits.size() > HALF_GCD_CUTOFF) {
+      if (smallest._digits.size() > largest._digits.size() / 2 + 1) {
+        std::array<BigInt, 4> step;
+        half_gcd(largest, smallest, step);
+        compose_transforms(step, transform);
+      } else
+        euclid_step(largest, smallest, transform);
+    }
+    while (smallest && largest._digits.size() > 2)
+      lehmer_step(largest, smallest, transform);
+    if (smallest) {
+      DoubleDigit largest_value = reduce_digits<DoubleDigit>(largest._digits),
+                  smallest_value = reduce_digits<DoubleDigit>(smallest._digits);
+      SignedDoubleDigit step[4] = {1, 0, 0, 1};
+      while (smallest_value) {
+        const DoubleDigit quotient = largest_value / smallest_value,
+                          remainder = largest_value % smallest_value;
+        largest_value = smallest_value;
+        smallest_value = remainder;
+        const SignedDoubleDigit next_third_coefficient =
+                                    step[0] - quotient * step[2],
+                                next_fourth_coefficient =
+                                    step[1] - quotient * step[3];
+        step[0] = step[2];
+        step[1] = step[3];
+        step[2] = next_third_coefficient;
+        step[3] = next_fourth_coefficient;
+      }
+      largest = BigInt(largest_value);
+      smallest = BigInt();
+      compose_transforms(
+          {BigInt(step[0]), BigInt(step[1]), BigInt(step[2]), BigInt(step[3])},
+          transform);
+    }
+    first_coefficient = swapped ? transform[1] : transform[0];
+    if (is_negative()) first_coefficient = -first_coefficient;
+    if (!other) {
+      first_coefficient = BigInt(_sign);
+      second_coefficient = BigInt();
+      return largest;
+    }
+    first_coefficient = first_coefficient.mod((other / largest).abs());
+    second_coefficient = (largest - first_coefficient * *this) / other;
+    return largest;
+  }
+
   void divmod(const BigInt& divisor, BigInt& quotient,
               BigInt& remainder) const {
     divmod<true, true>(divisor, &quotient, &remainder);
   }
 
+  void divmod(const BigInt& divisor, const BigInt& reciprocal, BigInt& quotient,
+              BigInt& remainder) const {
+    if (!divisor) throw ZeroDivisionError();
+    if (!*this || divisor._digits.size() == 1 ||
+        digits_lesser_than(_digits, divisor._digits)) {
+      divmod(divisor, quotient, remainder);
+      return;
+    }
+    Digits quotient_digits, remainder_digits;
+    divrem_digits_by_reciprocal(_digits, divisor._digits, reciprocal._digits,
+                                quotient_digits, remainder_digits);
+    const bool has_remainder =
+        remainder_digits.size() > 1 || remainder_digits[0] != 0;
+    quotient =
+        BigInt(_sign * divisor._sign *
+                   (quotient_digits.size() > 1 || quotient_digits[0] != 0),
+               std::move(quotient_digits));
+    remainder = BigInt(_sign * has_remainder, std::move(remainder_digits));
+    if (has_remainder && _sign != divisor._sign) {
+      quotient = quotient - BigInt(1, Digits({1}));
+      remainder = remainder + divisor;
+    }
+  }
+
   BigInt invmod(const BigInt& divisor) const {
-    BigInt candidate, result{1u}, step_dividend = *this, step_divisor = divisor;
-    while (step_divisor) {
-      BigInt quotient, remainder;
-      step_dividend.divmod(step_divisor, quotient, remainder);
-      step_dividend = step_divisor;
-      step_divisor = remainder;
-      const BigInt next_candidate = result - quotient * candidate;
-      result = candidate;
-      candidate = next_candidate;
-    }
-    if (step_dividend.is_one()) {
-      if (result.is_negative()) result = divisor + result;
-      return result;
+    BigInt result, divisor_coefficient;
+    if (!xgcd(divisor, result, divisor_coefficient).is_one())
+      throw std::invalid_argument("Not invertible.");
+    if (divisor.is_negative() && result) result = divisor + result;
+    return result;
+  }
+
+  BigInt iroot(const BigInt& degree) const {
+    if (!degree.is_positive())
+      throw std::invalid_argument("Root degree should be positive.");
+    if (is_negative()) {
+      if (!(degree._digits[0] & 1))
+        throw std::invalid_argument(
+            "Even degree root of negative number is undefined.");
+      return -(-*this).iroot(degree);
+    }
+    const std::size_t bits_count = digits_bit_length(_digits);
+    const std::size_t degree_value =
+        safe_reduce_digits<std::size_t>(degree._digits, bits_count);
+    if (degree_value == 1) return *this;
+    if (degree_value >= bits_count) return BigInt(_sign);
+    if (degree_value == 2) return isqrt();
+    const BigInt degree_predecessor(degree_value - 1);
+    const std::size_t root_bits_count = bits_count / degree_value + 1;
+    BigInt result;
+    if (root_bits_count <= ROOT_NEWTON_BITS_CUTOFF)
+      result = root_upper_estimate(degree_value);
+    else {
+      const std::size_t root_shift = root_bits_count / 2;
+      result = ((*this >> degree_value * root_shift).iroot(degree) + 1)
+               << root_shift;
+    }
+    for (;;) {
+      BigInt candidate = (result * (degree_value - 1) +
+                          floor_divide(result.power(degree_predecessor)))
+                             .floor_divide(degree);
+      if (candidate >= result) return result;
+      result = std::move(candidate);
     }
-    throw std::invalid_argument("Not invertible.");
   }
 
   bool is_negative() const noexcept { return _sign < 0; }
@@ -459,14 +561,92 @@ class BigInt {
     return is_positive() && _digits.size() == 1 && _digits[0] == 1;
   }
 
+  bool is_perfect_power() const {
+    if (_digits.size() == 1 && _digits[0] <= 1) return true;
+    const std::size_t bits_count = digits_bit_length(_digits);
+    std::size_t trailing_zeros_count = 0;
+    while (!digits_bit(_digits, trailing_zeros_count)) ++trailing_zeros_count;
+    const BigInt value = abs() >> trailing_zeros_count;
+    for (std::size_t degree = 2 + is_negative(); degree < bits_count;
+         degree += 1 + (degree > 2)) {
+      if (trailing_zeros_count % degree || !is_small_prime(degree)) continue;
+      if (degree == 2) {
+        if ((value._digits[0] & 7) != 1) continue;
+        BigInt root, remainder;
+        value.square_root_with_remainder(root, remainder);
+        if (!remainder) return true;
+        continue;
+      }
+      std::size_t root_exponent;
+      const double root_fraction = value.root_estimate(degree, root_exponent);
+      BigInt root;
+      if (root_exponent <= ROOT_ESTIMATE_EXACT_BITS_COUNT) {
+        const double estimate = std::ldexp(root_fraction, root_exponent);
+        const double nearest_integer_root = std::round(estimate);
+        if (std::abs(estimate - nearest_integer_root) > ROOT_ESTIMATE_TOLERANCE)
+          continue;
+        root = BigInt(static_cast<std::uint64_t>(nearest_integer_root));
+        const BigInt mask(BINARY_DIGIT_MASK);
+        const TruncationContext context(mask);
+        if (exponentiate(context, root, BigInt(degree)._digits)._digits[0] !=
+            value._digits[0])
+          continue;
+      } else {
+        if (degree <= POWER_RESIDUE_DEGREE_CUTOFF &&
+            !has_power_residues(value._digits, degree))
+          continue;
+        root = value.two_adic_root(degree, root_exponent + 2);
+        std::size_t candidate_exponent;
+        const double candidate_fraction =
+            root.root_estimate(1, candidate_exponent);
+        const double candidate = std::ldexp(
+            candidate_fraction, static_cast<int>(candidate_exponent) -
+                                    static_cast<int>(root_exponent));
+        if (std::ldexp(std::abs(candidate - root_fraction),
+                       ROOT_ESTIMATE_EXACT_BITS_COUNT) >
+            ROOT_ESTIMATE_TOLERANCE)
+          continue;
+      }
+      if (root.power(BigInt(degree)) == value) return true;
+    }
+    return false;
+  }
+
   bool is_positive() const noexcept { return _sign > 0; }
 
+  BigInt isqrt() const {
+    if (is_negative())
+      throw std::invalid_argument(
+          "Square root of negative number is undefined.");
+    BigInt result, remainder;
+    square_root_with_remainder(result, remainder);
+    return result;
+  }
+
+  BigInt lcm(const BigInt& other) const {
+    if (!*this || !other) return BigInt();
+    const BigInt divisor = gcd(other);
+    BigInt result =
+        divisor.is_one() ? *this * other : divide_exact(divisor) * other;
+    result._sign = 1;
+    return result;
+  }
+
   BigInt mod(const BigInt& divisor) const {
     BigInt result;
     divmod<false, true>(divisor, nullptr, &result);
     return result;
   }
 
+  BigInt perm(const BigInt& count) const {
+    if (is_negative() || count.is_negative())
+      throw std::invalid_argument(
+          "Permutations count of negative numbers is undefined.");
+    if (count > *this) return BigInt();
+    if (count == *this) return factorial();
+    return falling_factorial<false>(to_count(count));
+  }
+
   BigInt power(const BigInt& exponent) const {
     return power(exponent, NoModulus{});
   }
@@ -475,6 +655,17 @@ class BigInt {
     return power(exponent, modulus);
   }
 
+  static BigInt product(const std::vector<BigInt>& values) {
+    return product_tree(values.data(), values.size());
+  }
+
+  BigInt reciprocal() const {
+    if (!*this) throw ZeroDivisionError();
+    return BigInt(1, reciprocal_digits(_digits, 2 * _digits.size()));
+  }
+
+  class ModulusContext;
+
   template <std::size_t BASE = 10,
             std::size_t TARGET_SHIFT =
                 (BINARY_BASE < BASE ? 1 : floor_log<BASE>(BINARY_BASE)),
@@ -524,7 +715,7 @@ class BigInt {
     return std::ldexp(fraction, exponent);
   }
 
-  BigInt operator+(const BigInt& other) const noexcept {
+  BigInt operator+(const BigInt& other) const& noexcept {
     if (_digits.size() == 1 && other._digits.size() == 1)
       return BigInt(signed_digit() + other.signed_digit());
     if (is_negative()) {
@@ -532,36 +723,123 @@ class BigInt {
         return BigInt(-1, sum_digits(_digits, other._digits));
       else {
         Sign sign{1};
-        std::vector<Digit> digits =
-            subtract_digits(other._digits, _digits, sign);
-        return BigInt(sign, digits);
+        Digits digits = subtract_digits(other._digits, _digits, sign);
+        return BigInt(sign, std::move(digits));
       }
     } else if (other.is_negative()) {
       Sign sign{1};
-      std::vector<Digit> digits = subtract_digits(_digits, other._digits, sign);
-      return BigInt(sign, digits);
+      Digits digits = subtract_digits(_digits, other._digits, sign);
+      return BigInt(sign, std::move(digits));
     } else
       return BigInt(_sign | other._sign, sum_digits(_digits, other._digits));
   }
 
-  BigInt operator&(const BigInt& other) const noexcept {
+  BigInt operator+(const BigInt& other) && noexcept {
+    *this += other;
+    return std::move(*this);
+  }
+
+  BigInt& operator+=(const BigInt& other) noexcept {
+    if (_digits.size() == 1 && other._digits.size() == 1)
+      return *this = BigInt(signed_digit() + other.signed_digit());
+    if (!other) return *this;
+    if (!*this) return *this = other;
+    if (_sign == other._sign)
+      sum_digits_in_place(_digits, other._digits);
+    else
+      subtract_digits_in_place(_digits, other._digits, _sign);
+    return *this;
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator+(T other) const& noexcept {
+    return *this + BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator+(T other) && noexcept {
+    *this += other;
+    return std::move(*this);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt& operator+=(T other) noexcept {
+    return *this += BigInt(other);
+  }
+
+  BigInt operator&(const BigInt& other) const& noexcept {
     Sign sign;
-    const auto digits = _digits.size() > other._digits.size()
-                            ? bitwise_and_digits(_digits, _sign, other._digits,
-                                                 other._sign, sign)
-                            : bitwise_and_digits(other._digits, other._sign,
-                                                 _digits, _sign, sign);
-    return BigInt(sign, digits);
+    auto digits = _digits.size() > other._digits.size()
+                      ? bitwise_and_digits(_digits, _sign, other._digits,
+                                           other._sign, sign)
+                      : bitwise_and_digits(other._digits, other._sign, _digits,
+                                           _sign, sign);
+    return BigInt(sign, std::move(digits));
+  }
+
+  BigInt operator&(const BigInt& other) && noexcept {
+    *this &= other;
+    return std::move(*this);
   }
 
-  BigInt operator*(const BigInt& other) const noexcept {
+  BigInt& operator&=(const BigInt& other) noexcept {
+    if (is_negative() || other.is_negative()) return *this = *this & other;
+    const std::size_t size = std::min(_digits.size(), other._digits.size());
+    for (std::size_t index = 0; index < size; ++index)
+      _digits[index] &= other._digits[index];
+    _digits.resize(size);
+    trim_leading_zeros(_digits);
+    _sign *= (_digits.size() > 1 || _digits[0] != 0);
+    return *this;
+  }
+
+  BigInt operator*(const BigInt& other) const& noexcept {
     return _digits.size() == 1 && other._digits.size() == 1
                ? BigInt(signed_double_digit() * other.signed_double_digit())
                : BigInt(_sign * other._sign,
                         multiply_digits(_digits, other._digits));
   }
 
-  BigInt operator-() const noexcept { return BigInt(-_sign, _digits); }
+  BigInt operator*(const BigInt& other) && noexcept {
+    *this *= other;
+    return std::move(*this);
+  }
+
+  BigInt& operator*=(const BigInt& other) noexcept {
+    if (_digits.size() == 1 && other._digits.size() == 1)
+      return *this =
+                 BigInt(signed_double_digit() * other.signed_double_digit());
+    if (!*this || !other) return *this = BigInt();
+    if (other._digits.size() == 1)
+      multiply_digits_by_digit_in_place(_digits, other._digits[0]);
+    else
+      _digits = multiply_digits(_digits, other._digits);
+    _sign *= other._sign;
+    return *this;
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator*(T other) const& noexcept {
+    return *this * BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator*(T other) && noexcept {
+    *this *= other;
+    return std::move(*this);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt& operator*=(T other) noexcept {
+    return *this *= BigInt(other);
+  }
+
+  BigInt operator-() const& noexcept { return BigInt(-_sign, _digits); }
+
+  BigInt operator-() && noexcept {
+    _sign = -_sign;
+    return std::move(*this);
+  }
 
   BigInt operator~() const noexcept {
     if (_digits.size() == 1) return BigInt(-signed_digit() - 1);
@@ -569,49 +847,112 @@ class BigInt {
       return BigInt(-1, sum_digits(_digits, {1}));
     else {
       Sign sign{1};
-      std::vector<Digit> digits = subtract_digits(_digits, {1}, sign);
-      return BigInt(sign, digits);
+      Digits digits = subtract_digits(_digits, {1}, sign);
+      return BigInt(sign, std::move(digits));
     }
   }
 
-  BigInt operator-(const BigInt& other) const noexcept {
+  BigInt operator-(const BigInt& other) const& noexcept {
     if (_digits.size() == 1 && other._digits.size() == 1)
       return BigInt(signed_digit() - other.signed_digit());
     if (is_negative()) {
       if (other.is_negative()) {
         Sign sign{1};
-        std::vector<Digit> digits =
-            subtract_digits(other._digits, _digits, sign);
-        return BigInt(sign, digits);
+        Digits digits = subtract_digits(other._digits, _digits, sign);
+        return BigInt(sign, std::move(digits));
       } else
         return BigInt(-1, sum_digits(_digits, other._digits));
     } else if (other.is_negative())
       return BigInt(1, sum_digits(_digits, other._digits));
     else {
       Sign sign = _sign | other._sign;
-      std::vector<Digit> digits = subtract_digits(_digits, other._digits, sign);
-      return BigInt(sign, digits);
+      Digits digits = subtract_digits(_digits, other._digits, sign);
+      return BigInt(sign, std::move(digits));
     }
   }
 
-  BigInt operator|(const BigInt& other) const noexcept {
+  BigInt operator-(const BigInt& other) && noexcept {
+    *this -= other;
+    return std::move(*this);
+  }
+
+  BigInt& operator-=(const BigInt& other) noexcept {
+    if (_digits.size() == 1 && other._digits.size() == 1)
+      return *this = BigInt(signed_digit() - other.signed_digit());
+    if (!other) return *this;
+    if (!*this) return *this = -other;
+    if (_sign == other._sign)
+      subtract_digits_in_place(_digits, other._digits, _sign);
+    else
+      sum_digits_in_place(_digits, other._digits);
+    return *this;
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator-(T other) const& noexcept {
+    return *this - BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator-(T other) && noexcept {
+    *this -= other;
+    return std::move(*this);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt& operator-=(T other) noexcept {
+    return *this -= BigInt(other);
+  }
+
+  BigInt operator|(const BigInt& other) const& noexcept {
     Sign sign;
-    const auto digits = _digits.size() > other._digits.size()
-                            ? bitwise_or_digits(_digits, _sign, other._digits,
-                                                other._sign, sign)
-                            : bitwise_or_digits(other._digits, other._sign,
-                                                _digits, _sign, sign);
-    return BigInt(sign, digits);
+    auto digits = _digits.size() > other._digits.size()
+                      ? bitwise_or_digits(_digits, _sign, other._digits,
+                                          other._sign, sign)
+                      : bitwise_or_digits(other._digits, other._sign, _digits,
+                                          _sign, sign);
+    return BigInt(sign, std::move(digits));
+  }
+
+  BigInt operator|(const BigInt& other) && noexcept {
+    *this |= other;
+    return std::move(*this);
+  }
+
+  BigInt& operator|=(const BigInt& other) noexcept {
+    if (is_negative() || other.is_negative()) return *this = *this | other;
+    if (_digits.size() < other._digits.size())
+      _digits.resize(other._digits.size(), 0);
+    for (std::size_t index = 0; index < other._digits.size(); ++index)
+      _digits[index] |= other._digits[index];
+    _sign |= other._sign;
+    return *this;
   }
 
-  BigInt operator^(const BigInt& other) const noexcept {
+  BigInt operator^(const BigInt& other) const& noexcept {
     Sign sign;
-    const auto digits = _digits.size() > other._digits.size()
-                            ? bitwise_xor_digits(_digits, _sign, other._digits,
-                                                 other._sign, sign)
-                            : bitwise_xor_digits(other._digits, other._sign,
-                                                 _digits, _sign, sign);
-    return BigInt(sign, digits);
+    auto digits = _digits.size() > other._digits.size()
+                      ? bitwise_xor_digits(_digits, _sign, other._digits,
+                                           other._sign, sign)
+                      : bitwise_xor_digits(other._digits, other._sign, _digits,
+                                           _sign, sign);
+    return BigInt(sign, std::move(digits));
+  }
+
+  BigInt operator^(const BigInt& other) && noexcept {
+    *this ^= other;
+    return std::move(*this);
+  }
+
+  BigInt& operator^=(const BigInt& other) noexcept {
+    if (is_negative() || other.is_negative()) return *this = *this ^ other;
+    if (_digits.size() < other._digits.size())
+      _digits.resize(other._digits.size(), 0);
+    for (std::size_t index = 0; index < other._digits.size(); ++index)
+      _digits[index] ^= other._digits[index];
+    trim_leading_zeros(_digits);
+    _sign = (_digits.size() > 1 || _digits[0] != 0);
+    return *this;
   }
 
   bool operator==(const BigInt& other) const noexcept {
@@ -648,6 +989,31 @@ class BigInt {
                  : digits_lesser_than_or_equal(_digits, other._digits)));
   }
 
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  bool operator==(T other) const noexcept {
+    return *this == BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  bool operator<(T other) const noexcept {
+    return *this < BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  bool operator<=(T other) const noexcept {
+    return *this <= BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  bool operator>(T other) const noexcept {
+    return *this > BigInt(other);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  bool operator>=(T other) const noexcept {
+    return *this >= BigInt(other);
+  }
+
   BigInt operator/(const BigInt& divisor) const {
     BigInt result;
     divrem<true, false>(divisor, &result, nullptr);
@@ -660,59 +1026,95 @@ class BigInt {
     return result;
   }
 
-  BigInt operator<<(const BigInt& shift) const {
-    if (shift.is_negative()) {
-      throw std::invalid_argument("Shift by negative step is undefined.");
-    } else if (!*this) {
-      return *this;
-    } else {
-      std::vector<Digit> shift_quotient_digits;
-      Digit shift_remainder = divrem_digits_by_digit(
-          shift._digits, static_cast<Digit>(BINARY_SHIFT),
-          shift_quotient_digits);
-      const std::size_t shift_quotient = safe_reduce_digits<std::size_t>(
-          shift_quotient_digits, MAX_DIGITS_COUNT);
-      if (shift_quotient >= MAX_DIGITS_COUNT)
-        throw std::overflow_error("Too large shift step.");
-      else
-        return BigInt(
-            _sign, shift_digits_left(_digits, shift_quotient, shift_remainder));
-    }
+  BigInt operator<<(const BigInt& shift) const& {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_left(shift_quotient, shift_remainder);
   }
 
-  BigInt operator>>(const BigInt& shift) const {
-    if (shift.is_negative()) {
-      throw std::invalid_argument("Shift by negative step is undefined.");
-    } else if (!*this) {
-      return *this;
-    } else {
-      std::vector<Digit> shift_quotient_digits;
-      Digit shift_remainder = divrem_digits_by_digit(
-          shift._digits, static_cast<Digit>(BINARY_SHIFT),
-          shift_quotient_digits);
-      const std::size_t shift_quotient = safe_reduce_digits<std::size_t>(
-          shift_quotient_digits, MAX_DIGITS_COUNT);
-      if (shift_quotient >= MAX_DIGITS_COUNT)
-        return this->is_negative() ? ~BigInt() : BigInt();
-      else if (this->is_negative()) {
-        const auto inverted = ~*this;
-        const auto digits = shift_digits_right(inverted._digits, shift_quotient,
-                                               shift_remainder);
-        return ~BigInt(inverted._sign * (digits.size() > 1 || digits[0] != 0),
-                       digits);
-      } else {
-        const auto digits =
-            shift_digits_right(_digits, shift_quotient, shift_remainder);
-        return BigInt(_sign * (digits.size() > 1 || digits[0] != 0), digits);
-      }
-    }
+  BigInt operator<<(const BigInt& shift) && {
+    *this <<= shift;
+    return std::move(*this);
+  }
+
+  BigInt& operator<<=(const BigInt& shift) {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_left_in_place(shift_quotient, shift_remainder);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator<<(T shift) const& {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_left(shift_quotient, shift_remainder);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator<<(T shift) && {
+    *this <<= shift;
+    return std::move(*this);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt& operator<<=(T shift) {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_left_in_place(shift_quotient, shift_remainder);
+  }
+
+  BigInt operator>>(const BigInt& shift) const& {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_right(shift_quotient, shift_remainder);
+  }
+
+  BigInt operator>>(const BigInt& shift) && {
+    *this >>= shift;
+    return std::move(*this);
+  }
+
+  BigInt& operator>>=(const BigInt& shift) {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_right_in_place(shift_quotient, shift_remainder);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator>>(T shift) const& {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_right(shift_quotient, shift_remainder);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt operator>>(T shift) && {
+    *this >>= shift;
+    return std::move(*this);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  BigInt& operator>>=(T shift) {
+    Digit shift_remainder;
+    const std::size_t shift_quotient =
+        to_shift_quotient(shift, shift_remainder);
+    return shift_right_in_place(shift_quotient, shift_remainder);
   }
 
  protected:
-  BigInt(Sign sign, const std::vector<Digit>& digits)
-      : _sign(sign), _digits(digits) {}
+  BigInt(Sign sign, const Digits& digits) : _sign(sign), _digits(digits) {}
 
-  const std::vector<Digit>& digits() const noexcept { return _digits; }
+  BigInt(Sign sign, Digits&& digits) noexcept
+      : _sign(sign), _digits(std::move(digits)) {}
+
+  const Digits& digits() const noexcept { return _digits; }
 
   SignedDigit signed_digit() const noexcept {
     return _sign * static_cast<SignedDigit>(_digits[0]);
@@ -724,106 +1126,149 @@ class BigInt {
 
  private:
   Sign _sign;
-  std::vector<Digit> _digits;
+  Digits _digits;
 
   static constexpr std::size_t MAX_DIGITS_COUNT =
       std::numeric_limits<std::size_t>::max() / sizeof(Digit);
-  static constexpr std::size_t WINDOW_CUTOFF = 8;
-  static constexpr std::size_t WINDOW_SHIFT = 5;
-  static constexpr std::size_t WINDOW_BASE = 1 << WINDOW_SHIFT;
-  using WindowDigit = std::uint8_t;
-  static_assert(WINDOW_SHIFT <= std::numeric_limits<WindowDigit>::digits,
-                "Window digit type should be able to contain window digits.");
-
-  static std::vector<Digit> bitwise_and_digits(std::vector<Digit> longest,
-                                               const Sign longest_sign,
-                                               std::vector<Digit> shortest,
-                                               const Sign shortest_sign,
-                                               Sign& sign) noexcept {
-    if (longest_sign < 0) longest = complement_digits(std::move(longest));
-    if (shortest_sign < 0) shortest = complement_digits(std::move(shortest));
-    const std::size_t result_size =
-        shortest_sign < 0 ? longest.size() : shortest.size();
-    std::vector<Digit> result;
-    result.reserve(result_size);
-    for (std::size_t index = 0; index < shortest.size(); ++index)
-      result.push_back(longest[index] & shortest[index]);
-    for (std::size_t index = shortest.size(); index < result_size; ++index)
-      result.push_back(longest[index]);
-    sign = longest_sign & shortest_sign;
-    if (sign < 0) {
-      result.push_back(BINARY_DIGIT_MASK);
-      result = complement_digits(std::move(result));
-    }
-    trim_leading_zeros(result);
-    sign *= (result.size() > 1 || result[0] != 0);
+  static constexpr std::size_t WINDOW_WIDTH_CUTOFFS[] = {23, 79, 239, 671,
+                                                         1791};
+  static constexpr std::size_t MAX_WINDOW_CACHE_SIZE = 1 << 22;
+  static constexpr std::size_t KARATSUBA_CUTOFF = BINARY_SHIFT > 32 ? 24 : 70;
+  static constexpr std::size_t KARATSUBA_SQUARE_CUTOFF = KARATSUBA_CUTOFF * 2;
+  static constexpr std::size_t TOOM_3_CUTOFF = BINARY_SHIFT > 32 ? 400 : 2000;
+  static constexpr std::size_t NUMBER_THEORETIC_CUTOFF =
+      BINARY_SHIFT > 32 ? 32000 : 8000;
+  static constexpr std::uint32_t NUMBER_THEORETIC_MODULI[3] = {
+      998244353, 167772161, 469762049};
+  static constexpr std::uint32_t NUMBER_THEORETIC_GENERATOR = 3;
+  static constexpr std::size_t NUMBER_THEORETIC_MAX_SIZE = 1 << 23;
+  static constexpr std::size_t NUMBER_THEORETIC_MAX_LIMB_SHIFT = 31;
+  static constexpr std::size_t NUMBER_THEORETIC_LIMBS_COUNT =
+      BINARY_SHIFT > NUMBER_THEORETIC_MAX_LIMB_SHIFT ? 2 : 1;
+  static constexpr std::size_t NUMBER_THEORETIC_LIMB_SHIFT =
+      BINARY_SHIFT / NUMBER_THEORETIC_LIMBS_COUNT;
+  static constexpr bool NUMBER_THEORETIC_SUPPORTED =
+      NUMBER_THEORETIC_LIMB_SHIFT <= NUMBER_THEORETIC_MAX_LIMB_SHIFT &&
+      NUMBER_THEORETIC_LIMB_SHIFT * NUMBER_THEORETIC_LIMBS_COUNT ==
+          BINARY_SHIFT;
+  static constexpr std::size_t BURNIKEL_ZIEGLER_CUTOFF =
+      BINARY_SHIFT > 32 ? 60 : 120;
+  static constexpr std::size_t HALF_GCD_CUTOFF =
+      BINARY_SHIFT > 32 ? 4000 : 1000;
+  static constexpr std::size_t HALF_GCD_BASE_CUTOFF =
+      BINARY_SHIFT > 32 ? 400 : 100;
+  static constexpr std::size_t MONTGOMERY_CUTOFF =
+      BINARY_SHIFT > 32 ? 200 : 400;
+  static constexpr std::size_t BARRETT_CUTOFF = 50;
+  static constexpr std::size_t NEWTON_CUTOFF =
+      BINARY_SHIFT > 32 ? 200000 : 80000;
+  static constexpr std::size_t RECIPROCAL_NEWTON_CUTOFF = 50;
+  static constexpr std::size_t RADIX_CONVERSION_CUTOFF = 100;
+  static constexpr std::size_t SQUARE_ROOT_BASE_BITS_COUNT =
+      std::numeric_limits<double>::digits - 1;
+  static constexpr std::size_t ROOT_ESTIMATE_EXACT_BITS_COUNT = 32;
+  static constexpr double ROOT_ESTIMATE_TOLERANCE = 1.0 / 256;
+  static constexpr std::size_t ROOT_NEWTON_BITS_CUTOFF = 128;
+  static constexpr std::size_t POWER_RESIDUE_DEGREE_CUTOFF = 64;
+  static constexpr std::size_t POWER_RESIDUE_CHECKS_COUNT = 4;
+  static constexpr std::size_t BINOMIAL_SIEVE_CUTOFF = 100;
+  static constexpr std::size_t BINOMIAL_SIEVE_RATIO = 32;
+
+  static Digits bitwise_and_digits(const Digits& longest,
+                                   const Sign longest_sign,
+                                   const Digits& shortest,
+                                   const Sign shortest_sign,
+                                   Sign& sign) noexcept {
+    const bool is_negative = longest_sign < 0 && shortest_sign < 0;
+    Digits result =
+        bitwise_digits(longest, longest_sign < 0, shortest, shortest_sign < 0,
+                       shortest_sign < 0 ? longest.size() : shortest.size(),
+                       is_negative, std::bit_and<Digit>());
+    sign = is_negative ? -1 : (result.size() > 1 || result[0] != 0);
     return result;
   }
 
-  static std::vector<Digit> bitwise_or_digits(std::vector<Digit> longest,
-                                              const Sign longest_sign,
-                                              std::vector<Digit> shortest,
-                                              const Sign shortest_sign,
-                                              Sign& sign) noexcept {
-    if (longest_sign < 0) longest = complement_digits(std::move(longest));
-    if (shortest_sign < 0) shortest = complement_digits(std::move(shortest));
-    const std::size_t result_size =
-        shortest_sign < 0 ? shortest.size() : longest.size();
-    std::vector<Digit> result;
-    result.reserve(result_size);
-    for (std::size_t index = 0; index < shortest.size(); ++index)
-      result.push_back(longest[index] | shortest[index]);
-    for (std::size_t index = shortest.size(); index < result_size; ++index)
-      result.push_back(longest[index]);
-    sign = longest_sign | shortest_sign;
-    if (sign < 0) {
-      result.push_back(BINARY_DIGIT_MASK);
-      result = complement_digits(std::move(result));
-    }
-    trim_leading_zeros(result);
+  static Digits bitwise_or_digits(const Digits& longest,
+                                  const Sign longest_sign,
+                                  const Digits& shortest,
+                                  const Sign shortest_sign,
+                                  Sign& sign) noexcept {
+    const bool is_negative = longest_sign < 0 || shortest_sign < 0;
+    Digits result =
+        bitwise_digits(longest, longest_sign < 0, shortest, shortest_sign < 0,
+                       shortest_sign < 0 ? shortest.size() : longest.size(),
+                       is_negative, std::bit_or<Digit>());
+    sign = is_negative ? -1 : (result.size() > 1 || result[0] != 0);
     return result;
   }
 
-  static std::vector<Digit> bitwise_xor_digits(std::vector<Digit> longest,
-                                               const Sign longest_sign,
-                                               std::vector<Digit> shortest,
-                                               const Sign shortest_sign,
-                                               Sign& sign) noexcept {
-    if (longest_sign < 0) longest = complement_digits(std::move(longest));
-    if (shortest_sign < 0) shortest = complement_digits(std::move(shortest));
-    std::vector<Digit> result = std::move(longest);
-    for (std::size_t index = 0; index < shortest.size(); ++index)
-      result[index] ^= shortest[index];
-    if (shortest_sign < 0)
-      for (std::size_t index = shortest.size(); index < result.size(); ++index)
-        result[index] ^= BINARY_DIGIT_MASK;
-    const bool sign_is_negative = (longest_sign < 0) ^ (shortest_sign < 0);
-    if (sign_is_negative) {
-      result.push_back(BINARY_DIGIT_MASK);
-      result = complement_digits(std::move(result));
-    }
-    trim_leading_zeros(result);
-    sign = (sign_is_negative ? -1 : 1) * (result.size() > 1 || result[0] != 0);
+  static Digits bitwise_xor_digits(const Digits& longest,
+                                   const Sign longest_sign,
+                                   const Digits& shortest,
+                                   const Sign shortest_sign,
+                                   Sign& sign) noexcept {
+    const bool is_negative = (longest_sign < 0) != (shortest_sign < 0);
+    Digits result =
+        bitwise_digits(longest, longest_sign < 0, shortest, shortest_sign < 0,
+                       longest.size(), is_negative, std::bit_xor<Digit>());
+    sign = is_negative ? -1 : (result.size() > 1 || result[0] != 0);
     return result;
   }
 
-  static std::vector<Digit> complement_digits(
-      const std::vector<Digit>& digits) noexcept {
-    std::vector<Digit> result;
-    result.reserve(digits.size());
-    Digit accumulator = 1;
-    for (const auto digit : digits) {
-      accumulator += digit ^ BINARY_DIGIT_MASK;
-      result.push_back(accumulator & BINARY_DIGIT_MASK);
-      accumulator >>= BINARY_SHIFT;
-    }
-    assert(accumulator == 0);
+  template <class Operation>
+  static Digits bitwise_digits(const Digits& longest,
+                               const bool longest_is_negative,
+                               const Digits& shortest,
+                               const bool shortest_is_negative,
+                               const std::size_t size,
+                               const bool result_is_negative,
+                               Operation operation) noexcept {
+    const Digit longest_mask = longest_is_negative ? BINARY_DIGIT_MASK : 0,
+                shortest_mask = shortest_is_negative ? BINARY_DIGIT_MASK : 0,
+                result_mask = result_is_negative ? BINARY_DIGIT_MASK : 0;
+    Digit longest_carry = longest_is_negative,
+          shortest_carry = shortest_is_negative,
+          result_carry = result_is_negative;
+    Digits result(size);
+    const std::size_t common_size = std::min(size, shortest.size());
+    std::size_t index = 0;
+    for (; index < common_size; ++index)
+      result[index] = complement_digit(
+          operation(
+              complement_digit(longest[index], longest_mask, longest_carry),
+              complement_digit(shortest[index], shortest_mask, shortest_carry)),
+          result_mask, result_carry);
+    for (; index < size; ++index)
+      result[index] = complement_digit(
+          operation(
+              complement_digit(longest[index], longest_mask, longest_carry),
+              shortest_mask),
+          result_mask, result_carry);
+    if (result_carry) result.push_back(result_carry);
+    trim_leading_zeros(result);
     return result;
   }
 
-  static void divrem_two_or_more_digits(
-      const std::vector<Digit>& dividend, const std::vector<Digit>& divisor,
-      std::vector<Digit>& quotient, std::vector<Digit>& remainder) noexcept {
+  static bool digits_have_bits_below(const Digits& digits,
+                                     std::size_t shift_quotient,
+                                     const Digit shift_remainder) noexcept {
+    const std::size_t size = std::min(shift_quotient, digits.size());
+    return std::any_of(digits.begin(), digits.begin() + size,
+                       [](Digit digit) { return digit != 0; }) ||
+           (shift_quotient < digits.size() &&
+            (digits[shift_quotient] & ((Digit(1) << shift_remainder) - 1)));
+  }
+
+  static Digit complement_digit(const Digit digit, const Digit mask,
+                                Digit& carry) noexcept {
+    const Digit result = (digit ^ mask) + carry;
+    carry = result >> BINARY_SHIFT;
+    return result & BINARY_DIGIT_MASK;
+  }
+
+  static void divrem_two_or_more_digits(const Digits& dividend,
+                                        const Digits& divisor, Digits& quotient,
+                                        Digits& remainder) noexcept {
     std::size_t dividend_digits_count = dividend.size();
     const std::size_t divisor_digits_count = divisor.size();
     Digit* const dividend_normalized = new Digit[dividend_digits_count + 1]();
@@ -890,23 +1335,22 @@ class BigInt {
       }
       *--quotient_position = quotient_digit;
     }
-    quotient = quotient_size ? std::vector<Digit>(quotient_data,
-                                                  quotient_data + quotient_size)
-                             : std::vector<Digit>({0});
+    quotient = quotient_size
+                   ? Digits(quotient_data, quotient_data + quotient_size)
+                   : Digits({0});
     delete[] quotient_data;
     trim_leading_zeros(quotient);
     shift_digits_right_in_place(dividend_normalized, divisor_digits_count,
                                 shift, divisor_normalized);
     delete[] dividend_normalized;
-    remainder = std::vector<Digit>(divisor_normalized,
-                                   divisor_normalized + divisor_digits_count);
+    remainder =
+        Digits(divisor_normalized, divisor_normalized + divisor_digits_count);
     delete[] divisor_normalized;
     trim_leading_zeros(remainder);
   }
 
-  static Digit divrem_digits_by_digit(const std::vector<Digit>& dividend,
-                                      Digit divisor,
-                                      std::vector<Digit>& quotient) noexcept {
+  static Digit divrem_digits_by_digit(const Digits& dividend, Digit divisor,
+                                      Digits& quotient) noexcept {
     DoubleDigit remainder = 0;
     std::size_t digits_count = dividend.size();
     Digit* const quotient_data = new Digit[digits_count]();
@@ -916,13 +1360,460 @@ class BigInt {
           static_cast<Digit>(remainder / divisor);
       remainder -= static_cast<DoubleDigit>(quotient_digit) * divisor;
     }
-    quotient =
-        std::vector<Digit>(quotient_data, quotient_data + dividend.size());
+    quotient = Digits(quotient_data, quotient_data + dividend.size());
     delete[] quotient_data;
     trim_leading_zeros(quotient);
     return static_cast<Digit>(remainder);
   }
 
+  static bool lehmer_coefficients(
+      const Digits& largest_digits, const Digits& smallest_digits,
+      SignedDoubleDigit (&coefficients)[4]) noexcept {
+    const std::size_t largest_digits_count = largest_digits.size(),
+                      smallest_digits_count = smallest_digits.size();
+    const std::size_t highest_digit_bit_length =
+        cppbuiltins::bit_length(largest_digits.back());
+    SignedDoubleDigit largest_leading_bits =
+        (static_cast<SignedDoubleDigit>(
+             largest_digits[largest_digits_count - 1])
+         << (2 * BINARY_SHIFT - highest_digit_bit_length)) |
+        (static_cast<SignedDoubleDigit>(
+             largest_digits[largest_digits_count - 2])
+         << (BINARY_SHIFT - highest_digit_bit_length)) |
+        static_cast<SignedDoubleDigit>(
+            largest_digits[largest_digits_count - 3] >>
+            highest_digit_bit_length);
+    SignedDoubleDigit smallest_leading_bits =
+        (smallest_digits_count >= largest_digits_count - 2
+             ? static_cast<SignedDoubleDigit>(
+                   smallest_digits[largest_digits_count - 3] >>
+                   highest_digit_bit_length)
+             : 0) |
+        (smallest_digits_count >= largest_digits_count - 1
+             ? static_cast<SignedDoubleDigit>(
+                   smallest_digits[largest_digits_count - 2])
+                   << (BINARY_SHIFT - highest_digit_bit_length)
+             : 0) |
+        (smallest_digits_count >= largest_digits_count
+             ? static_cast<SignedDoubleDigit>(
+                   smallest_digits[largest_digits_count - 1])
+                   << (2 * BINARY_SHIFT - highest_digit_bit_length)
+             : 0);
+    SignedDoubleDigit first_coefficient = 1, second_coefficient = 0,
+                      third_coefficient = 0, fourth_coefficient = 1;
+    std::size_t iterations_count = 0;
+    for (;; ++iterations_count) {
+      if (third_coefficient == smallest_leading_bits) break;
+      const SignedDoubleDigit scale =
+          (largest_leading_bits + (first_coefficient - 1)) /
+          (smallest_leading_bits - third_coefficient);
+      const SignedDoubleDigit next_third_coefficient =
+          second_coefficient + scale * fourth_coefficient;
+      const SignedDoubleDigit next_smallest_leading_bits =
+          largest_leading_bits - scale * smallest_leading_bits;
+      if (next_third_coefficient > next_smallest_leading_bits) break;
+      largest_leading_bits = smallest_leading_bits;
+      smallest_leading_bits = next_smallest_leading_bits;
+      const SignedDoubleDigit next_fourth_coefficient =
+          first_coefficient + scale * third_coefficient;
+      first_coefficient = fourth_coefficient;
+      second_coefficient = third_coefficient;
+      third_coefficient = next_third_coefficient;
+      fourth_coefficient = next_fourth_coefficient;
+    }
+    if (iterations_count == 0) return false;
+    if (iterations_count & 1) {
+      first_coefficient = -first_coefficient;
+      second_coefficient = -second_coefficient;
+      third_coefficient = -third_coefficient;
+      fourth_coefficient = -fourth_coefficient;
+      std::swap(first_coefficient, second_coefficient);
+      std::swap(third_coefficient, fourth_coefficient);
+    }
+    coefficients[0] = first_coefficient;
+    coefficients[1] = second_coefficient;
+    coefficients[2] = third_coefficient;
+    coefficients[3] = fourth_coefficient;
+    return true;
+  }
+
+  static void apply_lehmer_coefficients(
+      const SignedDoubleDigit (&coefficients)[4], Digits& largest_digits,
+      Digits& smallest_digits) noexcept {
+    const std::size_t largest_digits_count = largest_digits.size(),
+                      smallest_digits_count = smallest_digits.size();
+    const SignedDoubleDigit first_coefficient = coefficients[0],
+                            second_coefficient = coefficients[1],
+                            third_coefficient = coefficients[2],
+                            fourth_coefficient = coefficients[3];
+    SignedDoubleDigit next_largest_accumulator = 0;
+    SignedDoubleDigit next_smallest_accumulator = 0;
+    std::size_t index = 0;
+    Digits next_largest_digits, next_smallest_digits;
+    next_largest_digits.reserve(largest_digits_count);
+    next_smallest_digits.reserve(largest_digits_count);
+    for (; index < smallest_digits_count; ++index) {
+      next_largest_accumulator += (first_coefficient * largest_digits[index]) -
+                                  (second_coefficient * smallest_digits[index]);
+      next_smallest_accumulator +=
+          (fourth_coefficient * smallest_digits[index]) -
+          (third_coefficient * largest_digits[index]);
+      next_largest_digits.push_back(
+          static_cast<Digit>(next_largest_accumulator & BINARY_DIGIT_MASK));
+      next_smallest_digits.push_back(
+          static_cast<Digit>(next_smallest_accumulator & BINARY_DIGIT_MASK));
+      next_largest_accumulator >>= BINARY_SHIFT;
+      next_smallest_accumulator >>= BINARY_SHIFT;
+    }
+    for (; index < largest_digits_count; ++index) {
+      next_largest_accumulator += first_coefficient * largest_digits[index];
+      next_smallest_accumulator -= third_coefficient * largest_digits[index];
+      next_largest_digits.push_back(
+          static_cast<Digit>(next_largest_accumulator & BINARY_DIGIT_MASK));
+      next_smallest_digits.push_back(
+          static_cast<Digit>(next_smallest_accumulator & BINARY_DIGIT_MASK));
+      next_largest_accumulator >>= BINARY_SHIFT;
+      next_smallest_accumulator >>= BINARY_SHIFT;
+    }
+    trim_leading_zeros(next_largest_digits);
+    trim_leading_zeros(next_smallest_digits);
+    largest_digits = next_largest_digits;
+    smallest_digits = next_smallest_digits;
+  }
+
+  static void half_gcd(BigInt& largest, BigInt& smallest,
+                       std::array<BigInt, 4>& transform) {
+    const std::size_t size = largest._digits.size(), threshold = size / 2 + 1;
+    transform = {BigInt(1, {1}), BigInt(), BigInt(), BigInt(1, {1})};
+    if (smallest._digits.size() <= threshold) return;
+    if (size <= HALF_GCD_BASE_CUTOFF) {
+      while (smallest._digits.size() > threshold)
+        lehmer_step(largest, smallest, transform);
+      return;
+    }
+    half_gcd_step(largest, smallest, size / 2, transform);
+    if (smallest._digits.size() > threshold)
+      euclid_step(largest, smallest, transform);
+    const std::size_t largest_size = largest._digits.size();
+    if (smallest._digits.size() > threshold && largest_size < size)
+      half_gcd_step(
+          largest, smallest,
+          2 * threshold > largest_size ? 2 * threshold - largest_size : 0,
+          transform);
+    while (smallest._digits.size() > threshold)
+      euclid_step(largest, smallest, transform);
+  }
+
+  static void half_gcd_step(BigInt& largest, BigInt& smallest,
+                            std::size_t shift,
+                            std::array<BigInt, 4>& transform) {
+    const Digits largest_high_digits =
+                     shift_digits_right(largest._digits, shift, 0),
+                 smallest_high_digits =
+                     shift_digits_right(smallest._digits, shift, 0);
+    BigInt largest_high(
+        largest_high_digits.size() > 1 || largest_high_digits[0] != 0,
+        largest_high_digits);
+    BigInt smallest_high(
+        smallest_high_digits.size() > 1 || smallest_high_digits[0] != 0,
+        smallest_high_digits);
+    std::array<BigInt, 4> step;
+    half_gcd(largest_high, smallest_high, step);
+    BigInt next_largest = step[0] * largest + step[1] * smallest,
+           next_smallest = step[2] * largest + step[3] * smallest;
+    if (next_largest.is_negative()) {
+      next_largest = -next_largest;
+      step[0] = -step[0];
+      step[1] = -step[1];
+    }
+    if (next_smallest.is_negative()) {
+      next_smallest = -next_smallest;
+      step[2] = -step[2];
+      step[3] = -step[3];
+    }
+    if (next_largest < next_smallest) {
+      std::swap(next_largest, next_smallest);
+      std::swap(step[0], step[2]);
+      std::swap(step[1], step[3]);
+    }
+    largest = next_largest;
+    smallest = next_smallest;
+    compose_transforms(step, transform);
+  }
+
+  static void compose_transforms(const std::array<BigInt, 4>& step,
+                                 std::array<BigInt, 4>& transform) {
+    transform = {step[0] * transform[0] + step[1] * transform[2],
+                 step[0] * transform[1] + step[1] * transform[3],
+                 step[2] * transform[0] + step[3] * transform[2],
+                 step[2] * transform[1] + step[3] * transform[3]};
+  }
+
+  static void euclid_step(BigInt& largest, BigInt& smallest,
+                          std::array<BigInt, 4>& transform) {
+    BigInt quotient, remainder;
+    largest.divmod(smallest, quotient, remainder);
+    largest = smallest;
+    smallest = remainder;
+    transform = {transform[2], transform[3],
+                 transform[0] - quotient * transform[2],
+                 transform[1] - quotient * transform[3]};
+  }
+
+  static void lehmer_step(BigInt& largest, BigInt& smallest,
+                          std::array<BigInt, 4>& transform) {
+    SignedDoubleDigit coefficients[4];
+    if (!lehmer_coefficients(largest._digits, smallest._digits, coefficients)) {
+      euclid_step(largest, smallest, transform);
+      return;
+    }
+    apply_lehmer_coefficients(coefficients, largest._digits, smallest._digits);
+    largest._sign = largest._digits.size() > 1 || largest._digits[0] != 0;
+    smallest._sign = smallest._digits.size() > 1 || smallest._digits[0] != 0;
+    const BigInt first_coefficient(coefficients[0]),
+        second_coefficient(coefficients[1]), third_coefficient(coefficients[2]),
+        fourth_coefficient(coefficients[3]);
+    transform = {
+        first_coefficient * transform[0] - second_coefficient * transform[2],
+        first_coefficient * transform[1] - second_coefficient * transform[3],
+        fourth_coefficient * transform[2] - third_coefficient * transform[0],
+        fourth_coefficient * transform[3] - third_coefficient * transform[1]};
+  }
+
+  static void divrem_digits(const Digits& dividend, const Digits& divisor,
+                            Digits& quotient, Digits& remainder) noexcept {
+    if (divisor.size() > NEWTON_CUTOFF &&
+        dividend.size() - divisor.size() > NEWTON_CUTOFF)
+      divrem_digits_newton(
+          dividend, divisor,
+          approximate_reciprocal_digits(divisor, dividend.size()),
+          dividend.size(), quotient, remainder);
+    else if (divisor.size() > BURNIKEL_ZIEGLER_CUTOFF &&
+             dividend.size() - divisor.size() > BURNIKEL_ZIEGLER_CUTOFF)
+      divrem_digits_burnikel_ziegler(dividend, divisor, quotient, remainder);
+    else
+      divrem_two_or_more_digits(dividend, divisor, quotient, remainder);
+  }
+
+  static void divrem_digits_burnikel_ziegler(const Digits& dividend,
+                                             const Digits& divisor,
+                                             Digits& quotient,
+                                             Digits& remainder) noexcept {
+    const std::size_t size = divisor.size();
+    const std::size_t shift =
+        BINARY_SHIFT - cppbuiltins::bit_length(divisor.back());
+    const Digits divisor_normalized = shift_digits_left(divisor, 0, shift);
+    const Digits dividend_normalized = shift_digits_left(dividend, 0, shift);
+    std::size_t blocks_count = dividend_normalized.size() / size;
+    remainder = slice_digits(dividend_normalized, blocks_count * size,
+                             dividend_normalized.size());
+    quotient.assign(blocks_count * size, 0);
+    while (blocks_count-- > 0) {
+      const std::size_t offset = blocks_count * size;
+      Digits block_quotient;
+      divrem_two_blocks_by_one(
+          join_digits(remainder,
+                      slice_digits(dividend_normalized, offset, offset + size),
+                      size),
+          divisor_normalized, size, block_quotient, remainder);
+      std::copy(block_quotient.begin(), block_quotient.end(),
+                quotient.begin() + offset);
+    }
+    trim_leading_zeros(quotient);
+    remainder = shift_digits_right(remainder, 0, shift);
+  }
+
+  static void divrem_two_blocks_by_one(Digits dividend, Digits divisor,
+                                       std::size_t size, Digits& quotient,
+                                       Digits& remainder) noexcept {
+    if (size <= BURNIKEL_ZIEGLER_CUTOFF ||
+        dividend.size() <= size + BURNIKEL_ZIEGLER_CUTOFF) {
+      if (digits_lesser_than(dividend, divisor)) {
+        quotient = {0};
+        remainder = dividend;
+      } else
+        divrem_two_or_more_digits(dividend, divisor, quotient, remainder);
+      return;
+    }
+    const bool padded = size & 1;
+    if (padded) {
+      dividend = shift_digits_left(dividend, 1, 0);
+      divisor = shift_digits_left(divisor, 1, 0);
+      ++size;
+    }
+    const std::size_t half = size >> 1;
+    const Digits divisor_high = slice_digits(divisor, half, size),
+                 divisor_low = slice_digits(divisor, 0, half);
+    Digits high_quotient, low_quotient;
+    divrem_three_halves_by_two(slice_digits(dividend, size, dividend.size()),
+                               slice_digits(dividend, half, size), divisor,
+                               divisor_high, divisor_low, half, high_quotient,
+                               remainder);
+    divrem_three_halves_by_two(remainder, slice_digits(dividend, 0, half),
+                               divisor, divisor_high, divisor_low, half,
+                               low_quotient, remainder);
+    quotient = join_digits(high_quotient, low_quotient, half);
+    if (padded) remainder = shift_digits_right(remainder, 1, 0);
+  }
+
+  static void divrem_three_halves_by_two(const Digits& dividend_high,
+                                         const Digits& dividend_low,
+                                         const Digits& divisor,
+                                         const Digits& divisor_high,
+                                         const Digits& divisor_low,
+                                         std::size_t size, Digits& quotient,
+                                         Digits& remainder) noexcept {
+    if (slice_digits(dividend_high, size, dividend_high.size()) ==
+        divisor_high) {
+      quotient = Digits(size, BINARY_DIGIT_MASK);
+      remainder =
+          sum_digits(slice_digits(dividend_high, 0, size), divisor_high);
+    } else
+      divrem_two_blocks_by_one(dividend_high, divisor_high, size, quotient,
+                               remainder);
+    remainder = join_digits(remainder, dividend_low, size);
+    const Digits product = multiply_digits(quotient, divisor_low);
+    Sign sign = 1;
+    while (digits_lesser_than(remainder, product)) {
+      quotient = subtract_digits(quotient, {1}, sign);
+      remainder = sum_digits(remainder, divisor);
+    }
+    remainder = subtract_digits(remainder, product, sign);
+  }
+
+  static void divrem_digits_by_reciprocal(const Digits& dividend,
+                                          const Digits& divisor,
+                                          const Digits& reciprocal,
+                                          Digits& quotient,
+                                          Digits& remainder) noexcept {
+    const std::size_t size = divisor.size();
+    if (dividend.size() <= 2 * size) {
+      divrem_digits_newton(dividend, divisor, reciprocal, 2 * size, quotient,
+                           remainder);
+      return;
+    }
+    std::size_t blocks_count = dividend.size() / size;
+    remainder = slice_digits(dividend, blocks_count * size, dividend.size());
+    quotient.assign(blocks_count * size, 0);
+    while (blocks_count-- > 0) {
+      const std::size_t offset = blocks_count * size;
+      Digits block_quotient;
+      divrem_digits_newton(
+          join_digits(remainder, slice_digits(dividend, offset, offset + size),
+                      size),
+          divisor, reciprocal, 2 * size, block_quotient, remainder);
+      std::copy(block_quotient.begin(), block_quotient.end(),
+                quotient.begin() + offset);
+    }
+    trim_leading_zeros(quotient);
+  }
+
+  static void divrem_digits_newton(const Digits& dividend,
+                                   const Digits& divisor,
+                                   const Digits& reciprocal,
+                                   std::size_t precision, Digits& quotient,
+                                   Digits& remainder) noexcept {
+    const std::size_t truncation = divisor.size() - 1;
+    quotient = shift_digits_right(
+        multiply_digits(slice_digits(dividend, truncation, dividend.size()),
+                        reciprocal),
+        precision - truncation, 0);
+    Sign sign = 1, remainder_sign = 1;
+    remainder = subtract_digits(dividend, multiply_digits(quotient, divisor),
+                                remainder_sign);
+    while (remainder_sign < 0) {
+      quotient = subtract_digits(quotient, {1}, sign);
+      remainder = subtract_digits(remainder, divisor, remainder_sign);
+    }
+    while (!digits_lesser_than(remainder, divisor)) {
+      quotient = sum_digits(quotient, {1});
+      remainder = subtract_digits(remainder, divisor, remainder_sign);
+    }
+  }
+
+  static Digits reciprocal_digits(const Digits& divisor,
+                                  std::size_t precision) noexcept {
+    Digits result = approximate_reciprocal_digits(divisor, precision);
+    Sign sign = 1, remainder_sign = 1;
+    Digits remainder =
+        subtract_digits(base_power_digits(precision),
+                        multiply_digits(divisor, result), remainder_sign);
+    while (remainder_sign < 0) {
+      result = subtract_digits(result, {1}, sign);
+      remainder = subtract_digits(remainder, divisor, remainder_sign);
+    }
+    while (!digits_lesser_than(remainder, divisor)) {
+      result = sum_digits(result, {1});
+      remainder = subtract_digits(remainder, divisor, remainder_sign);
+    }
+    return result;
+  }
+
+  static Digits approximate_reciprocal_digits(const Digits& divisor,
+                                              std::size_t precision) noexcept {
+    const std::size_t size = divisor.size();
+    if (precision < size + RECIPROCAL_NEWTON_CUTOFF) {
+      const Digits dividend = base_power_digits(precision);
+      if (digits_lesser_than(dividend, divisor)) return {0};
+      Digits quotient, remainder;
+      if (size == 1)
+        (void)divrem_digits_by_digit(dividend, divisor[0], quotient);
+      else
+        divrem_digits(dividend, divisor, quotient, remainder);
+      return quotient;
+    }
+    const std::size_t result_size = precision - size;
+    if (size > result_size + 2) {
+      const std::size_t truncation = size - result_size - 2;
+      return approximate_reciprocal_digits(
+          slice_digits(divisor, truncation, size), precision - truncation);
+    }
+    const std::size_t approximation_size = result_size / 2 + 2,
+                      shift = result_size - approximation_size,
+                      error_shift = precision - 2 * shift,
+                      error_truncation =
+                          error_shift > approximation_size + 2
+                              ? error_shift - approximation_size - 2
+                              : 0;
+    const Digits approximation =
+        approximate_reciprocal_digits(divisor, precision - shift);
+    Sign sign = 1, error_sign = 1;
+    const Digits error =
+        subtract_digits(base_power_digits(precision - shift),
+                        multiply_digits(divisor, approximation), error_sign);
+    const Digits correction = shift_digits_right(
+        multiply_digits(approximation,
+                        slice_digits(error, error_truncation, error.size())),
+        error_shift - error_truncation, 0);
+    const Digits result = shift_digits_left(approximation, shift, 0);
+    return error_sign < 0 ? subtract_digits(result, correction, sign)
+                          : sum_digits(result, correction);
+  }
+
+  static Digits base_power_digits(std::size_t exponent) noexcept {
+    Digits result(exponent + 1, 0);
+    result.back() = 1;
+    return result;
+  }
+
+  static Digits join_digits(const Digits& high, const Digits& low,
+                            std::size_t size) noexcept {
+    Digits result(size + high.size(), 0);
+    std::copy(low.begin(), low.end(), result.begin());
+    std::copy(high.begin(), high.end(), result.begin() + size);
+    trim_leading_zeros(result);
+    return result;
+  }
+
+  static Digits slice_digits(const Digits& digits, std::size_t start,
+                             std::size_t stop) noexcept {
+    stop = std::min<std::size_t>(stop, digits.size());
+    if (start >= stop) return {0};
+    Digits result(digits.begin() + start, digits.begin() + stop);
+    trim_leading_zeros(result);
+    return result;
+  }
+
   template <class Result,
             std::enable_if_t<std::is_floating_point_v<Result>, int> = 0>
   Result frexp(int& exponent) const {
@@ -992,20 +1883,22 @@ class BigInt {
     return _sign * result_modulus;
   }
 
-  template <class Result,
-            std::enable_if_t<std::is_arithmetic_v<Result>, int> = 0>
-  static Result reduce_digits(const std::vector<Digit>& digits) noexcept {
+  template <
+      class Result,
+      std::enable_if_t<std::numeric_limits<Result>::is_specialized, int> = 0>
+  static Result reduce_digits(const Digits& digits) noexcept {
     Result result = 0;
     for (auto position = digits.rbegin(); position != digits.rend(); ++position)
-      if constexpr (std::is_integral_v<Result>)
+      if constexpr (std::numeric_limits<Result>::is_integer)
         result = (result << BINARY_SHIFT) | *position;
       else
         result = (result * BINARY_BASE) + *position;
     return result;
   }
 
-  template <class Result, std::enable_if_t<std::is_integral_v<Result>, int> = 0>
-  static Result safe_reduce_digits(const std::vector<Digit>& digits,
+  template <class Result,
+            std::enable_if_t<std::numeric_limits<Result>::is_integer, int> = 0>
+  static Result safe_reduce_digits(const Digits& digits,
                                    const Result fallback) noexcept {
     Result candidate = 0;
     for (auto position = digits.rbegin(); position != digits.rend();
@@ -1017,12 +1910,14 @@ class BigInt {
     return candidate;
   }
 
-  static Digit subtract_digits_in_place(
-      Digit* longest, std::size_t size_longest,
-      const std::vector<Digit>& shortest) noexcept {
+  static Digit subtract_digits_in_place(Digit* longest,
+                                        std::size_t size_longest,
+                                        const Digit* shortest,
+                                        std::size_t size_shortest) noexcept {
     Digit accumulator = 0;
-    std::size_t index = 0;
-    for (; index < shortest.size(); ++index) {
+    std::size_t index = subtract_digits_vectorized<Digit, BINARY_SHIFT>(
+        longest, shortest, size_shortest, longest, accumulator);
+    for (; index < size_shortest; ++index) {
       accumulator = longest[index] - shortest[index] - accumulator;
       longest[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
@@ -1037,10 +1932,9 @@ class BigInt {
     return accumulator;
   }
 
-  static std::vector<Digit> subtract_digits(const std::vector<Digit>& first,
-                                            const std::vector<Digit>& second,
-                                            Sign& sign) noexcept {
-    const std::vector<Digit>*longest = &first, *shortest = &second;
+  static Digits subtract_digits(const Digits& first, const Digits& second,
+                                Sign& sign) noexcept {
+    const Digits *longest = &first, *shortest = &second;
     std::size_t size_longest = longest->size(),
                 size_shortest = shortest->size();
     Digit accumulator = 0;
@@ -1062,18 +1956,19 @@ class BigInt {
       }
       size_longest = size_shortest = index + 1;
     }
-    std::vector<Digit> result;
-    result.reserve(size_longest);
-    std::size_t index = 0;
+    Digits result(size_longest);
+    std::size_t index = subtract_digits_vectorized<Digit, BINARY_SHIFT>(
+        longest->data(), shortest->data(), size_shortest, result.data(),
+        accumulator);
     for (; index < size_shortest; ++index) {
       accumulator = (*longest)[index] - (*shortest)[index] - accumulator;
-      result.push_back(accumulator & BINARY_DIGIT_MASK);
+      result[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
       accumulator &= 1;
     }
     for (; index < size_longest; ++index) {
       accumulator = (*longest)[index] - accumulator;
-      result.push_back(accumulator & BINARY_DIGIT_MASK);
+      result[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
       accumulator &= 1;
     }
@@ -1081,12 +1976,38 @@ class BigInt {
     return result;
   }
 
-  static Digit sum_digits_in_place(
-      Digit* longest, std::size_t size_longest,
-      const std::vector<Digit>& shortest) noexcept {
+  static void subtract_digits_in_place(Digits& digits, const Digits& subtrahend,
+                                       Sign& sign) noexcept {
+    if (digits == subtrahend) {
+      digits.assign(1, 0);
+      sign = 0;
+      return;
+    } else if (digits_lesser_than(digits, subtrahend)) {
+      const std::size_t size = subtrahend.size();
+      digits.resize(size, 0);
+      Digit accumulator = 0;
+      std::size_t index = subtract_digits_vectorized<Digit, BINARY_SHIFT>(
+          subtrahend.data(), digits.data(), size, digits.data(), accumulator);
+      for (; index < size; ++index) {
+        accumulator = subtrahend[index] - digits[index] - accumulator;
+        digits[index] = accumulator & BINARY_DIGIT_MASK;
+        accumulator >>= BINARY_SHIFT;
+        accumulator &= 1;
+      }
+      sign = -sign;
+    } else
+      (void)subtract_digits_in_place(digits.data(), digits.size(),
+                                     subtrahend.data(), subtrahend.size());
+    trim_leading_zeros(digits);
+  }
+
+  static Digit sum_digits_in_place(Digit* longest, std::size_t size_longest,
+                                   const Digit* shortest,
+                                   std::size_t size_shortest) noexcept {
     Digit accumulator = 0;
-    std::size_t index = 0;
-    for (; index < shortest.size(); ++index) {
+    std::size_t index = sum_digits_vectorized<Digit, BINARY_SHIFT>(
+        longest, shortest, size_shortest, longest, accumulator);
+    for (; index < size_shortest; ++index) {
       accumulator += longest[index] + shortest[index];
       longest[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
@@ -1099,119 +2020,283 @@ class BigInt {
     return accumulator;
   }
 
-  static std::vector<Digit> sum_digits(
-      const std::vector<Digit>& first,
-      const std::vector<Digit>& second) noexcept {
-    const std::vector<Digit>*longest = &first, *shortest = &second;
+  static Digits sum_digits(const Digits& first, const Digits& second) noexcept {
+    const Digits *longest = &first, *shortest = &second;
     std::size_t size_longest = longest->size(),
                 size_shortest = shortest->size();
     if (size_longest < size_shortest) {
       std::swap(size_longest, size_shortest);
       std::swap(longest, shortest);
     }
-    std::vector<Digit> result;
-    result.reserve(size_longest + 1);
+    Digits result(size_longest + 1);
     Digit accumulator = 0;
-    std::size_t index = 0;
+    std::size_t index = sum_digits_vectorized<Digit, BINARY_SHIFT>(
+        longest->data(), shortest->data(), size_shortest, result.data(),
+        accumulator);
     for (; index < size_shortest; ++index) {
       accumulator += (*longest)[index] + (*shortest)[index];
-      result.push_back(accumulator & BINARY_DIGIT_MASK);
+      result[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
     }
     for (; index < size_longest; ++index) {
       accumulator += (*longest)[index];
-      result.push_back(accumulator & BINARY_DIGIT_MASK);
+      result[index] = accumulator & BINARY_DIGIT_MASK;
       accumulator >>= BINARY_SHIFT;
     }
-    result.push_back(accumulator);
+    result[index] = accumulator;
     trim_leading_zeros(result);
     return result;
   }
 
-  static void split_digits(const std::vector<Digit>& digits, std::size_t size,
-                           std::vector<Digit>& high,
-                           std::vector<Digit>& low) noexcept {
+  static void sum_digits_in_place(Digits& digits,
+                                  const Digits& addend) noexcept {
+    const std::size_t size_addend = addend.size();
+    if (digits.size() < size_addend) digits.resize(size_addend, 0);
+    const Digit accumulator = sum_digits_in_place(digits.data(), digits.size(),
+                                                  addend.data(), size_addend);
+    if (accumulator) digits.push_back(accumulator);
+  }
+
+  static void split_digits(const Digits& digits, std::size_t size, Digits& high,
+                           Digits& low) noexcept {
     const std::size_t size_low = std::min<std::size_t>(digits.size(), size);
-    const typename std::vector<Digit>::const_iterator mid =
-        digits.begin() + size_low;
-    low = std::vector<Digit>(digits.begin(), mid);
-    high = std::vector<Digit>(mid, digits.end());
+    const typename Digits::const_iterator mid = digits.begin() + size_low;
+    low = Digits(digits.begin(), mid);
+    high = mid == digits.end() ? Digits({0}) : Digits(mid, digits.end());
     trim_leading_zeros(high);
     trim_leading_zeros(low);
   }
 
-  static std::vector<Digit> multiply_digits(
-      const std::vector<Digit>& first,
-      const std::vector<Digit>& second) noexcept {
-    const std::vector<Digit>*shortest = &first, *longest = &second;
+  static void split_digits(const Digits& digits, std::size_t size, BigInt& high,
+                           BigInt& mid, BigInt& low) noexcept {
+    Digits rest, mid_digits, low_digits;
+    split_digits(digits, size, rest, low_digits);
+    Digits high_digits;
+    split_digits(rest, size, high_digits, mid_digits);
+    high = BigInt(high_digits.size() > 1 || high_digits[0] != 0,
+                  std::move(high_digits));
+    mid = BigInt(mid_digits.size() > 1 || mid_digits[0] != 0,
+                 std::move(mid_digits));
+    low = BigInt(low_digits.size() > 1 || low_digits[0] != 0,
+                 std::move(low_digits));
+  }
+
+  static Digit inverse_digit(Digit digit) noexcept {
+    DoubleDigit result = 1;
+    for (std::size_t precision = 1; precision < BINARY_SHIFT; precision <<= 1)
+      result = (result * (2 - digit * result)) & BINARY_DIGIT_MASK;
+    return static_cast<Digit>(result);
+  }
+
+  static Digits divide_digits_exact(const Digits& dividend,
+                                    const Digits& divisor) noexcept {
+    std::size_t shift_quotient = 0;
+    while (divisor[shift_quotient] == 0) ++shift_quotient;
+    std::size_t shift_remainder = 0;
+    while (!((divisor[shift_quotient] >> shift_remainder) & 1))
+      ++shift_remainder;
+    const Digits odd_divisor =
+        shift_digits_right(divisor, shift_quotient, shift_remainder);
+    Digits result =
+        shift_digits_right(dividend, shift_quotient, shift_remainder);
+    if (result.size() < odd_divisor.size()) return Digits({0});
+    const std::size_t size = result.size() - odd_divisor.size() + 1;
+    result.resize(size);
+    const DoubleDigit inverse = inverse_digit(odd_divisor[0]);
+    for (std::size_t index = 0; index < size; ++index) {
+      const Digit quotient_digit =
+          static_cast<Digit>((result[index] * inverse) & BINARY_DIGIT_MASK);
+      const std::size_t step_size = std::min(odd_divisor.size(), size - index);
+      Digit carry = static_cast<Digit>(
+          (static_cast<DoubleDigit>(quotient_digit) * odd_divisor[0]) >>
+          BINARY_SHIFT);
+      for (std::size_t offset = 1; offset < step_size; ++offset) {
+        const DoubleDigit product =
+            static_cast<DoubleDigit>(quotient_digit) * odd_divisor[offset] +
+            carry;
+        const Digit product_digit =
+            static_cast<Digit>(product & BINARY_DIGIT_MASK);
+        carry = static_cast<Digit>(product >> BINARY_SHIFT);
+        Digit& digit = result[index + offset];
+        if (digit < product_digit) {
+          digit += BINARY_BASE - product_digit;
+          ++carry;
+        } else
+          digit -= product_digit;
+      }
+      for (std::size_t position = index + step_size; carry && position < size;
+           ++position) {
+        Digit& digit = result[position];
+        if (digit < carry) {
+          digit += BINARY_BASE - carry;
+          carry = 1;
+        } else {
+          digit -= carry;
+          carry = 0;
+        }
+      }
+      result[index] = quotient_digit;
+    }
+    trim_leading_zeros(result);
+    return result;
+  }
+
+  static BigInt divide_by_digit(const BigInt& value, Digit divisor) noexcept {
+    Digits quotient_digits;
+    (void)divrem_digits_by_digit(value._digits, divisor, quotient_digits);
+    return BigInt(
+        value._sign * (quotient_digits.size() > 1 || quotient_digits[0] != 0),
+        std::move(quotient_digits));
+  }
+
+  static BigInt halve(const BigInt& value) noexcept {
+    Digits digits = shift_digits_right(value._digits, 0, 1);
+    return BigInt(value._sign * (digits.size() > 1 || digits[0] != 0),
+                  std::move(digits));
+  }
+
+  static void multiply_digits_by_digit_in_place(Digits& digits,
+                                                Digit multiplier) noexcept {
+    DoubleDigit accumulator = 0;
+    for (Digit& digit : digits) {
+      accumulator += static_cast<DoubleDigit>(digit) * multiplier;
+      digit = static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+      accumulator >>= BINARY_SHIFT;
+    }
+    if (accumulator) digits.push_back(static_cast<Digit>(accumulator));
+  }
+
+  static Digits multiply_digits(const Digits& first,
+                                const Digits& second) noexcept {
+    if (&first == &second) return square_digits(first);
+    const Digits *shortest = &first, *longest = &second;
     std::size_t size_shortest = shortest->size(),
                 size_longest = longest->size();
     if (size_longest < size_shortest) {
       std::swap(shortest, longest);
       std::swap(size_shortest, size_longest);
     }
-    static constexpr std::size_t KARATSUBA_CUTOFF = 70;
-    static constexpr std::size_t KARATSUBA_SQUARE_CUTOFF = KARATSUBA_CUTOFF * 2;
-    if (size_shortest <=
-        ((shortest == longest) ? KARATSUBA_SQUARE_CUTOFF : KARATSUBA_CUTOFF)) {
-      return size_shortest == 1 && (*shortest)[0] == 0
-                 ? std::vector<Digit>({0})
-                 : multiply_digits_plain(*shortest, *longest);
-    }
-    if (2 * size_shortest <= size_longest)
-      return multiply_digits_lopsided(*shortest, *longest);
-    const std::size_t shift = size_longest >> 1;
-    std::vector<Digit> shortest_high, shortest_low;
-    split_digits(*shortest, shift, shortest_high, shortest_low);
-    std::vector<Digit> longest_high, longest_low;
-    if (shortest == longest) {
-      longest_high = shortest_high;
-      longest_low = shortest_low;
-    } else
-      split_digits(*longest, shift, longest_high, longest_low);
-    std::vector<Digit> result(size_shortest + size_longest, 0);
-    const std::vector<Digit> highs_product =
-        multiply_digits(shortest_high, longest_high);
-    std::copy(highs_product.begin(), highs_product.end(),
-              result.begin() + 2 * shift);
-    const std::vector<Digit> lows_product =
-        multiply_digits(shortest_low, longest_low);
-    std::copy(lows_product.begin(), lows_product.end(), result.begin());
-    const std::size_t digits_after_shift = result.size() - shift;
-    (void)subtract_digits_in_place(result.data() + shift, digits_after_shift,
-                                   lows_product);
-    (void)subtract_digits_in_place(result.data() + shift, digits_after_shift,
-                                   highs_product);
-    const std::vector<Digit> shortest_components_sum =
-        sum_digits(shortest_high, shortest_low);
-    const std::vector<Digit> longest_components_sum =
-        (shortest == longest) ? shortest_components_sum
-                              : sum_digits(longest_high, longest_low);
-    const std::vector<Digit> components_sums_product =
-        multiply_digits(shortest_components_sum, longest_components_sum);
-    (void)sum_digits_in_place(result.data() + shift, digits_after_shift,
-                              components_sums_product);
+    if (size_shortest == 1 && (*shortest)[0] == 0) return {0};
+    if constexpr (NUMBER_THEORETIC_SUPPORTED)
+      if (size_shortest > NUMBER_THEORETIC_CUTOFF &&
+          (size_shortest + size_longest) * NUMBER_THEORETIC_LIMBS_COUNT - 1 <=
+              NUMBER_THEORETIC_MAX_SIZE)
+        return multiply_digits_number_theoretic(*shortest, *longest);
+    if (size_shortest > TOOM_3_CUTOFF)
+      return 2 * size_shortest <= size_longest
+                 ? multiply_digits_lopsided(*shortest, *longest)
+                 : multiply_digits_toom_3(*shortest, *longest);
+    Digits result(size_shortest + size_longest);
+    Digits workspace(karatsuba_workspace_size(size_shortest, size_longest));
+    multiply_digits_karatsuba(shortest->data(), size_shortest, longest->data(),
+                              size_longest, result.data(), workspace.data());
     trim_leading_zeros(result);
     return result;
   }
 
-  static std::vector<Digit> multiply_digits_lopsided(
-      const std::vector<Digit>& shortest,
-      const std::vector<Digit>& longest) noexcept {
+  static std::size_t karatsuba_workspace_size(
+      std::size_t size_shortest, std::size_t size_longest) noexcept {
+    if (size_shortest <= KARATSUBA_CUTOFF) return 0;
+    std::size_t result = 0, size = size_longest;
+    if (2 * size_shortest <= size_longest) {
+      result = 2 * size_shortest;
+      size = size_shortest;
+    }
+    while (size > KARATSUBA_CUTOFF) {
+      size -= (size >> 1) - 1;
+      result += 4 * size;
+    }
+    return result;
+  }
+
+  static void multiply_digits_karatsuba(const Digit* shortest,
+                                        std::size_t size_shortest,
+                                        const Digit* longest,
+                                        std::size_t size_longest, Digit* result,
+                                        Digit* workspace) noexcept {
+    if (size_shortest <= KARATSUBA_CUTOFF) {
+      multiply_digits_plain(shortest, size_shortest, longest, size_longest,
+                            result);
+      return;
+    }
+    const std::size_t size = size_shortest + size_longest;
+    if (2 * size_shortest <= size_longest) {
+      std::fill(result, result + size, 0);
+      Digit* const product = workspace;
+      for (std::size_t offset = 0; offset < size_longest;
+           offset += size_shortest) {
+        const std::size_t step_size =
+            std::min<std::size_t>(size_longest - offset, size_shortest);
+        if (step_size < size_shortest)
+          multiply_digits_karatsuba(longest + offset, step_size, shortest,
+                                    size_shortest, product,
+                                    workspace + 2 * size_shortest);
+        else
+          multiply_digits_karatsuba(shortest, size_shortest, longest + offset,
+                                    step_size, product,
+                                    workspace + 2 * size_shortest);
+        (void)sum_digits_in_place(result + offset, size - offset, product,
+                                  size_shortest + step_size);
+      }
+      return;
+    }
+    const std::size_t shift = size_longest >> 1,
+                      size_sum = size_longest - shift + 1;
+    multiply_digits_karatsuba(shortest, shift, longest, shift, result,
+                              workspace);
+    multiply_digits_karatsuba(shortest + shift, size_shortest - shift,
+                              longest + shift, size_longest - shift,
+                              result + 2 * shift, workspace);
+    Digit* const shortest_sum = workspace;
+    Digit* const longest_sum = shortest_sum + size_sum;
+    Digit* const product = longest_sum + size_sum;
+    sum_digits_halves(shortest, shift, size_shortest - shift, shortest_sum,
+                      size_sum);
+    sum_digits_halves(longest, shift, size_longest - shift, longest_sum,
+                      size_sum);
+    multiply_digits_karatsuba(shortest_sum, size_sum, longest_sum, size_sum,
+                              product, product + 2 * size_sum);
+    add_karatsuba_middle(result, size, shift, product, 2 * size_sum);
+  }
+
+  static void sum_digits_halves(const Digit* digits, std::size_t size_low,
+                                std::size_t size_high, Digit* result,
+                                std::size_t size) noexcept {
+    std::copy(digits, digits + size_low, result);
+    std::fill(result + size_low, result + size, 0);
+    (void)sum_digits_in_place(result, size, digits + size_low, size_high);
+  }
+
+  static void add_karatsuba_middle(Digit* result, std::size_t size,
+                                   std::size_t shift, Digit* product,
+                                   std::size_t size_product) noexcept {
+    (void)subtract_digits_in_place(product, size_product, result, 2 * shift);
+    (void)subtract_digits_in_place(product, size_product, result + 2 * shift,
+                                   size - 2 * shift);
+    (void)sum_digits_in_place(
+        result + shift, size - shift, product,
+        std::min<std::size_t>(size_product, size - shift));
+  }
+
+  static Digits multiply_digits_lopsided(const Digits& shortest,
+                                         const Digits& longest) noexcept {
     const std::size_t size_shortest = shortest.size();
     std::size_t size_longest = longest.size();
-    std::vector<Digit> result(size_shortest + size_longest, 0);
+    Digits result(size_shortest + size_longest, 0);
+    Digits step_digits;
+    step_digits.reserve(size_shortest);
     std::size_t processed_digits_count = 0;
     while (size_longest > 0) {
       const std::size_t step_digits_count =
           std::min<std::size_t>(size_longest, size_shortest);
-      const std::vector<Digit> step_digits(
+      step_digits.assign(
           longest.begin() + processed_digits_count,
           longest.begin() + processed_digits_count + step_digits_count);
-      const std::vector<Digit> product = multiply_digits(shortest, step_digits);
+      trim_leading_zeros(step_digits);
+      const Digits product = multiply_digits(shortest, step_digits);
       (void)sum_digits_in_place(result.data() + processed_digits_count,
                                 result.size() - processed_digits_count,
-                                product);
+                                product.data(), product.size());
       size_longest -= step_digits_count;
       processed_digits_count += step_digits_count;
     }
@@ -1219,61 +2304,364 @@ class BigInt {
     return result;
   }
 
-  static std::vector<Digit> multiply_digits_plain(
-      const std::vector<Digit>& first,
-      const std::vector<Digit>& second) noexcept {
-    std::size_t first_size = first.size(), second_size = second.size();
-    std::vector<Digit> result(first_size + second_size, 0);
-    if (&first == &second)
-      for (std::size_t index = 0; index < first_size; ++index) {
-        DoubleDigit digit = first[index];
-        auto result_position = result.begin() + (index << 1);
-        auto first_position = first.begin() + (index + 1);
-        DoubleDigit accumulator = *result_position + digit * digit;
+  static void multiply_digits_plain(const Digit* first, std::size_t first_size,
+                                    const Digit* second,
+                                    std::size_t second_size,
+                                    Digit* result) noexcept {
+    std::fill(result, result + first_size + second_size, 0);
+    for (std::size_t index = 0; index < first_size; ++index) {
+      DoubleDigit accumulator = 0;
+      const DoubleDigit digit = first[index];
+      Digit* result_position = result + index;
+      for (const Digit* second_position = second;
+           second_position != second + second_size;) {
+        accumulator += *result_position + *(second_position++) * digit;
         *(result_position++) =
             static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
         accumulator >>= BINARY_SHIFT;
-        digit <<= 1;
-        while (first_position != first.end()) {
-          accumulator += *result_position + *(first_position++) * digit;
-          *(result_position++) =
-              static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
-          accumulator >>= BINARY_SHIFT;
-        }
-        if (accumulator) {
-          accumulator += *result_position;
-          *(result_position++) =
-              static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
-          accumulator >>= BINARY_SHIFT;
-        }
-        if (accumulator)
-          *result_position +=
-              static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
       }
-    else
-      for (std::size_t index = 0; index < first_size; ++index) {
-        DoubleDigit accumulator = 0;
-        const DoubleDigit digit = first[index];
-        auto result_position = result.begin() + index;
-        auto second_position = second.begin();
-        while (second_position != second.end()) {
-          accumulator += *result_position + *(second_position++) * digit;
-          *(result_position++) =
-              static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
-          accumulator >>= BINARY_SHIFT;
-        }
-        if (accumulator)
-          *result_position +=
-              static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+      *result_position = static_cast<Digit>(accumulator);
+    }
+  }
+
+  static Digits multiply_digits_toom_3(const Digits& shortest,
+                                       const Digits& longest) noexcept {
+    const std::size_t shift = (longest.size() + 2) / 3;
+    BigInt shortest_high, shortest_low, shortest_at_one, shortest_at_minus_one,
+        shortest_at_minus_two;
+    evaluate_toom_3(shortest, shift, shortest_high, shortest_low,
+                    shortest_at_one, shortest_at_minus_one,
+                    shortest_at_minus_two);
+    BigInt longest_high, longest_low, longest_at_one, longest_at_minus_one,
+        longest_at_minus_two;
+    evaluate_toom_3(longest, shift, longest_high, longest_low, longest_at_one,
+                    longest_at_minus_one, longest_at_minus_two);
+    return interpolate_toom_3(shortest.size() + longest.size(), shift,
+                              shortest_low * longest_low,
+                              shortest_at_one * longest_at_one,
+                              shortest_at_minus_one * longest_at_minus_one,
+                              shortest_at_minus_two * longest_at_minus_two,
+                              shortest_high * longest_high);
+  }
+
+  static void evaluate_toom_3(const Digits& digits, std::size_t shift,
+                              BigInt& high, BigInt& low, BigInt& at_one,
+                              BigInt& at_minus_one,
+                              BigInt& at_minus_two) noexcept {
+    BigInt mid;
+    split_digits(digits, shift, high, mid, low);
+    const BigInt ends_sum = low + high;
+    at_one = ends_sum + mid;
+    at_minus_one = ends_sum - mid;
+    const BigInt at_minus_two_half = at_minus_one + high;
+    at_minus_two = at_minus_two_half + at_minus_two_half - low;
+  }
+
+  static Digits interpolate_toom_3(std::size_t size, std::size_t shift,
+                                   const BigInt& value_at_zero,
+                                   const BigInt& value_at_one,
+                                   const BigInt& value_at_minus_one,
+                                   const BigInt& value_at_minus_two,
+                                   const BigInt& value_at_infinity) noexcept {
+    BigInt third_coefficient =
+        divide_by_digit(value_at_minus_two - value_at_one, 3);
+    BigInt first_coefficient = halve(value_at_one - value_at_minus_one);
+    BigInt second_coefficient = value_at_minus_one - value_at_zero;
+    third_coefficient = halve(second_coefficient - third_coefficient) +
+                        value_at_infinity + value_at_infinity;
+    second_coefficient =
+        second_coefficient + first_coefficient - value_at_infinity;
+    first_coefficient = first_coefficient - third_coefficient;
+    Digits result(size, 0);
+    std::copy(value_at_zero._digits.begin(), value_at_zero._digits.end(),
+              result.begin());
+    const BigInt* const coefficients[4] = {
+        &first_coefficient, &second_coefficient, &third_coefficient,
+        &value_at_infinity};
+    for (std::size_t index = 0, offset = shift; index < 4;
+         ++index, offset += shift)
+      if (*coefficients[index])
+        (void)sum_digits_in_place(result.data() + offset,
+                                  result.size() - offset,
+                                  coefficients[index]->_digits.data(),
+                                  coefficients[index]->_digits.size());
+    trim_leading_zeros(result);
+    return result;
+  }
+
+  static Digits square_digits(const Digits& digits) noexcept {
+    const std::size_t size = digits.size();
+    if (size == 1 && digits[0] == 0) return {0};
+    if constexpr (NUMBER_THEORETIC_SUPPORTED)
+      if (size > NUMBER_THEORETIC_CUTOFF &&
+          2 * size * NUMBER_THEORETIC_LIMBS_COUNT - 1 <=
+              NUMBER_THEORETIC_MAX_SIZE)
+        return multiply_digits_number_theoretic(digits, digits);
+    if (size > TOOM_3_CUTOFF) return square_digits_toom_3(digits);
+    Digits result(2 * size);
+    Digits workspace(karatsuba_workspace_size(size, size));
+    square_digits_karatsuba(digits.data(), size, result.data(),
+                            workspace.data());
+    trim_leading_zeros(result);
+    return result;
+  }
+
+  static void square_digits_karatsuba(const Digit* digits, std::size_t size,
+                                      Digit* result,
+                                      Digit* workspace) noexcept {
+    if (size <= KARATSUBA_SQUARE_CUTOFF) {
+      square_digits_plain(digits, size, result);
+      return;
+    }
+    const std::size_t shift = size >> 1, size_sum = size - shift + 1;
+    square_digits_karatsuba(digits, shift, result, workspace);
+    square_digits_karatsuba(digits + shift, size - shift, result + 2 * shift,
+                            workspace);
+    Digit* const sum = workspace;
+    Digit* const product = sum + size_sum;
+    sum_digits_halves(digits, shift, size - shift, sum, size_sum);
+    square_digits_karatsuba(sum, size_sum, product, product + 2 * size_sum);
+    add_karatsuba_middle(result, 2 * size, shift, product, 2 * size_sum);
+  }
+
+  static void square_digits_plain(const Digit* digits, std::size_t size,
+                                  Digit* result) noexcept {
+    std::fill(result, result + 2 * size, 0);
+    for (std::size_t index = 0; index < size; ++index) {
+      DoubleDigit digit = digits[index];
+      Digit* result_position = result + (index << 1);
+      const Digit* digits_position = digits + (index + 1);
+      DoubleDigit accumulator = *result_position + digit * digit;
+      *(result_position++) =
+          static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+      accumulator >>= BINARY_SHIFT;
+      digit <<= 1;
+      while (digits_position != digits + size) {
+        accumulator += *result_position + *(digits_position++) * digit;
+        *(result_position++) =
+            static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+        accumulator >>= BINARY_SHIFT;
+      }
+      if (accumulator) {
+        accumulator += *result_position;
+        *(result_position++) =
+            static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+        accumulator >>= BINARY_SHIFT;
       }
+      if (accumulator)
+        *result_position += static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+    }
+  }
+
+  static Digits square_digits_toom_3(const Digits& digits) noexcept {
+    const std::size_t shift = (digits.size() + 2) / 3;
+    BigInt high, low, at_one, at_minus_one, at_minus_two;
+    evaluate_toom_3(digits, shift, high, low, at_one, at_minus_one,
+                    at_minus_two);
+    return interpolate_toom_3(2 * digits.size(), shift, low * low,
+                              at_one * at_one, at_minus_one * at_minus_one,
+                              at_minus_two * at_minus_two, high * high);
+  }
+
+  template <std::uint32_t MODULUS>
+  static constexpr std::uint32_t multiply_residues(
+      const std::uint32_t first, const std::uint32_t second) noexcept {
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(first) *
+                                      second % MODULUS);
+  }
+
+  template <std::uint32_t MODULUS>
+  static constexpr std::uint32_t power_residue(std::uint32_t base,
+                                               std::size_t exponent) noexcept {
+    std::uint32_t result = 1;
+    for (; exponent; exponent >>= 1) {
+      if (exponent & 1) result = multiply_residues<MODULUS>(result, base);
+      base = multiply_residues<MODULUS>(base, base);
+    }
+    return result;
+  }
+
+  template <std::uint32_t MODULUS>
+  static void transform_residues(std::vector<std::uint32_t>& values,
+                                 const bool inverse) noexcept {
+    const std::size_t size = values.size();
+    for (std::size_t index = 1, reversed_index = 0; index < size; ++index) {
+      std::size_t bit = size >> 1;
+      for (; reversed_index & bit; bit >>= 1) reversed_index ^= bit;
+      reversed_index |= bit;
+      if (index < reversed_index)
+        std::swap(values[index], values[reversed_index]);
+    }
+    std::vector<std::uint32_t> roots(std::max<std::size_t>(size >> 1, 1));
+    for (std::size_t length = 2; length <= size; length <<= 1) {
+      const std::size_t half_length = length >> 1;
+      std::uint32_t root = power_residue<MODULUS>(NUMBER_THEORETIC_GENERATOR,
+                                                  (MODULUS - 1) / length);
+      if (inverse) root = power_residue<MODULUS>(root, MODULUS - 2);
+      roots[0] = 1;
+      for (std::size_t index = 1; index < half_length; ++index)
+        roots[index] = multiply_residues<MODULUS>(roots[index - 1], root);
+      for (std::size_t start = 0; start < size; start += length)
+        for (std::size_t index = 0; index < half_length; ++index) {
+          const std::uint32_t first = values[start + index];
+          const std::uint32_t second = multiply_residues<MODULUS>(
+              values[start + index + half_length], roots[index]);
+          const std::uint32_t sum = first + second;
+          values[start + index] = sum >= MODULUS ? sum - MODULUS : sum;
+          values[start + index + half_length] =
+              first >= second ? first - second : first + MODULUS - second;
+        }
+    }
+    if (inverse) {
+      const std::uint32_t size_inverse = power_residue<MODULUS>(
+          static_cast<std::uint32_t>(size % MODULUS), MODULUS - 2);
+      for (auto& value : values)
+        value = multiply_residues<MODULUS>(value, size_inverse);
+    }
+  }
+
+  template <std::uint32_t MODULUS>
+  static std::vector<std::uint32_t> convolve_limbs(
+      const std::vector<std::uint32_t>& first,
+      const std::vector<std::uint32_t>& second, std::size_t size) noexcept {
+    std::vector<std::uint32_t> result(size, 0);
+    for (std::size_t index = 0; index < first.size(); ++index)
+      result[index] = first[index] % MODULUS;
+    transform_residues<MODULUS>(result, false);
+    if (&first == &second)
+      for (auto& value : result)
+        value = multiply_residues<MODULUS>(value, value);
+    else {
+      std::vector<std::uint32_t> second_residues(size, 0);
+      for (std::size_t index = 0; index < second.size(); ++index)
+        second_residues[index] = second[index] % MODULUS;
+      transform_residues<MODULUS>(second_residues, false);
+      for (std::size_t index = 0; index < size; ++index)
+        result[index] =
+            multiply_residues<MODULUS>(result[index], second_residues[index]);
+    }
+    transform_residues<MODULUS>(result, true);
+    return result;
+  }
+
+  static std::vector<std::uint32_t> digits_to_limbs(
+      const Digits& digits) noexcept {
+    constexpr Digit LIMB_MASK = (Digit(1) << NUMBER_THEORETIC_LIMB_SHIFT) - 1;
+    std::vector<std::uint32_t> result;
+    result.reserve(digits.size() * NUMBER_THEORETIC_LIMBS_COUNT);
+    for (const Digit digit : digits)
+      for (std::size_t shift = 0; shift < BINARY_SHIFT;
+           shift += NUMBER_THEORETIC_LIMB_SHIFT)
+        result.push_back(
+            static_cast<std::uint32_t>((digit >> shift) & LIMB_MASK));
+    return result;
+  }
+
+  static Digits limbs_to_digits(
+      const std::vector<std::uint32_t>& limbs) noexcept {
+    Digits result;
+    result.reserve((limbs.size() + NUMBER_THEORETIC_LIMBS_COUNT - 1) /
+                   NUMBER_THEORETIC_LIMBS_COUNT);
+    for (std::size_t index = 0; index < limbs.size();
+         index += NUMBER_THEORETIC_LIMBS_COUNT) {
+      Digit digit = 0;
+      for (std::size_t offset = 0; offset < NUMBER_THEORETIC_LIMBS_COUNT &&
+                                   index + offset < limbs.size();
+           ++offset)
+        digit |= static_cast<Digit>(limbs[index + offset])
+                 << (offset * NUMBER_THEORETIC_LIMB_SHIFT);
+      result.push_back(digit);
+    }
     trim_leading_zeros(result);
     return result;
   }
 
-  static std::vector<Digit> shift_digits_left(
-      const std::vector<Digit>& digits, const std::size_t shift_quotient,
-      const std::size_t shift_remainder) noexcept {
-    std::vector<Digit> result;
+  static Digits multiply_digits_number_theoretic(
+      const Digits& shortest, const Digits& longest) noexcept {
+    constexpr std::uint32_t FIRST_MODULUS = NUMBER_THEORETIC_MODULI[0];
+    constexpr std::uint32_t SECOND_MODULUS = NUMBER_THEORETIC_MODULI[1];
+    constexpr std::uint32_t THIRD_MODULUS = NUMBER_THEORETIC_MODULI[2];
+    constexpr std::uint32_t FIRST_MODULUS_INVERSE =
+        power_residue<SECOND_MODULUS>(FIRST_MODULUS % SECOND_MODULUS,
+                                      SECOND_MODULUS - 2);
+    constexpr std::uint64_t MODULI_PRODUCT =
+        static_cast<std::uint64_t>(FIRST_MODULUS) * SECOND_MODULUS;
+    constexpr std::uint32_t MODULI_PRODUCT_INVERSE =
+        power_residue<THIRD_MODULUS>(
+            static_cast<std::uint32_t>(MODULI_PRODUCT % THIRD_MODULUS),
+            THIRD_MODULUS - 2);
+    constexpr std::size_t LIMB_SHIFT = NUMBER_THEORETIC_LIMB_SHIFT;
+    constexpr std::uint64_t LIMB_MASK = (std::uint64_t(1) << LIMB_SHIFT) - 1;
+    constexpr std::size_t PRODUCT_LIMBS_COUNT =
+        (std::numeric_limits<std::uint64_t>::digits + LIMB_SHIFT - 1) /
+        LIMB_SHIFT;
+    const std::vector<std::uint32_t> shortest_limbs = digits_to_limbs(shortest);
+    const std::vector<std::uint32_t> longest_limbs =
+        &shortest == &longest ? std::vector<std::uint32_t>()
+                              : digits_to_limbs(longest);
+    const std::vector<std::uint32_t>& second_limbs =
+        &shortest == &longest ? shortest_limbs : longest_limbs;
+    const std::size_t coefficients_count =
+        shortest_limbs.size() + second_limbs.size() - 1;
+    std::size_t size = 1;
+    while (size < coefficients_count) size <<= 1;
+    const std::vector<std::uint32_t> first_residues =
+        convolve_limbs<FIRST_MODULUS>(shortest_limbs, second_limbs, size);
+    const std::vector<std::uint32_t> second_residues =
+        convolve_limbs<SECOND_MODULUS>(shortest_limbs, second_limbs, size);
+    const std::vector<std::uint32_t> third_residues =
+        convolve_limbs<THIRD_MODULUS>(shortest_limbs, second_limbs, size);
+    std::vector<std::uint32_t> result;
+    result.reserve(coefficients_count + 2 * PRODUCT_LIMBS_COUNT);
+    std::uint64_t accumulator[2 * PRODUCT_LIMBS_COUNT + 1] = {0};
+    for (std::size_t index = 0; index < coefficients_count; ++index) {
+      const std::uint32_t first_residue = first_residues[index];
+      const std::uint32_t second_coefficient =
+          multiply_residues<SECOND_MODULUS>(
+              (second_residues[index] + SECOND_MODULUS -
+               first_residue % SECOND_MODULUS) %
+                  SECOND_MODULUS,
+              FIRST_MODULUS_INVERSE);
+      const std::uint64_t low =
+          first_residue +
+          static_cast<std::uint64_t>(second_coefficient) * FIRST_MODULUS;
+      const std::uint32_t third_coefficient = multiply_residues<THIRD_MODULUS>(
+          (third_residues[index] + THIRD_MODULUS -
+           static_cast<std::uint32_t>(low % THIRD_MODULUS)) %
+              THIRD_MODULUS,
+          MODULI_PRODUCT_INVERSE);
+      std::uint64_t low_rest = low, moduli_product_rest = MODULI_PRODUCT;
+      for (std::size_t position = 0; position < PRODUCT_LIMBS_COUNT;
+           ++position) {
+        accumulator[position] += low_rest & LIMB_MASK;
+        low_rest >>= LIMB_SHIFT;
+        const std::uint64_t step =
+            static_cast<std::uint64_t>(third_coefficient) *
+            (moduli_product_rest & LIMB_MASK);
+        moduli_product_rest >>= LIMB_SHIFT;
+        accumulator[position] += step & LIMB_MASK;
+        accumulator[position + 1] += step >> LIMB_SHIFT;
+      }
+      result.push_back(static_cast<std::uint32_t>(accumulator[0] & LIMB_MASK));
+      accumulator[1] += accumulator[0] >> LIMB_SHIFT;
+      for (std::size_t position = 0; position < 2 * PRODUCT_LIMBS_COUNT;
+           ++position)
+        accumulator[position] = accumulator[position + 1];
+      accumulator[2 * PRODUCT_LIMBS_COUNT] = 0;
+    }
+    for (std::size_t position = 0; position < 2 * PRODUCT_LIMBS_COUNT;
+         ++position) {
+      result.push_back(
+          static_cast<std::uint32_t>(accumulator[position] & LIMB_MASK));
+      accumulator[position + 1] += accumulator[position] >> LIMB_SHIFT;
+    }
+    return limbs_to_digits(result);
+  }
+
+  static Digits shift_digits_left(const Digits& digits,
+                                  const std::size_t shift_quotient,
+                                  const std::size_t shift_remainder) noexcept {
+    Digits result;
     result.reserve(shift_quotient + !!(shift_remainder) + digits.size());
     for (std::size_t index = 0; index < shift_quotient; ++index)
       result.push_back(0);
@@ -1303,16 +2691,29 @@ class BigInt {
     return accumulator;
   }
 
-  static std::vector<Digit> shift_digits_right(
-      const std::vector<Digit>& digits, std::size_t shift_quotient,
-      const Digit shift_remainder) noexcept {
-    if (digits.size() <= shift_quotient) return std::vector<Digit>({0});
+  static void shift_digits_left_in_place(Digits& digits,
+                                         std::size_t shift_quotient,
+                                         std::size_t shift_remainder) noexcept {
+    const std::size_t size = digits.size();
+    digits.resize(size + shift_quotient + 1);
+    Digit* const data = digits.data();
+    std::copy_backward(data, data + size, data + size + shift_quotient);
+    std::fill_n(data, shift_quotient, 0);
+    data[size + shift_quotient] = shift_digits_left_in_place(
+        data + shift_quotient, size, shift_remainder, data + shift_quotient);
+    trim_leading_zeros(digits);
+  }
+
+  static Digits shift_digits_right(const Digits& digits,
+                                   std::size_t shift_quotient,
+                                   const Digit shift_remainder) noexcept {
+    if (digits.size() <= shift_quotient) return Digits({0});
     const std::size_t result_digits_count = digits.size() - shift_quotient;
     const std::size_t high_shift =
         BINARY_SHIFT - static_cast<std::size_t>(shift_remainder);
-    const Digit low_mask = (1 << high_shift) - 1;
+    const Digit low_mask = (Digit(1) << high_shift) - 1;
     const Digit high_mask = BINARY_DIGIT_MASK ^ low_mask;
-    std::vector<Digit> result(result_digits_count);
+    Digits result(result_digits_count);
     std::size_t position = shift_quotient;
     for (std::size_t index = 0; index < result_digits_count; ++index) {
       result[index] = (digits[position] >> shift_remainder) & low_mask;
@@ -1339,6 +2740,327 @@ class BigInt {
     return accumulator;
   }
 
+  static void shift_digits_right_in_place(
+      Digits& digits, std::size_t shift_quotient,
+      const Digit shift_remainder) noexcept {
+    if (digits.size() <= shift_quotient) {
+      digits.assign(1, 0);
+      return;
+    }
+    const std::size_t size = digits.size() - shift_quotient;
+    const std::size_t high_shift =
+        BINARY_SHIFT - static_cast<std::size_t>(shift_remainder);
+    const Digit low_mask = (Digit(1) << high_shift) - 1;
+    const Digit high_mask = BINARY_DIGIT_MASK ^ low_mask;
+    for (std::size_t index = 0; index < size; ++index) {
+      Digit digit =
+          (digits[index + shift_quotient] >> shift_remainder) & low_mask;
+      if (index + 1 < size)
+        digit |= (digits[index + shift_quotient + 1] << high_shift) & high_mask;
+      digits[index] = digit;
+    }
+    digits.resize(size);
+    trim_leading_zeros(digits);
+  }
+
+  BigInt shift_left(std::size_t shift_quotient,
+                    const Digit shift_remainder) const {
+    if (!*this)
+      return *this;
+    else if (shift_quotient >= MAX_DIGITS_COUNT)
+      throw std::overflow_error("Too large shift step.");
+    else
+      return BigInt(
+          _sign, shift_digits_left(_digits, shift_quotient, shift_remainder));
+  }
+
+  BigInt& shift_left_in_place(std::size_t shift_quotient,
+                              const Digit shift_remainder) {
+    if (!*this)
+      return *this;
+    else if (shift_quotient >= MAX_DIGITS_COUNT)
+      throw std::overflow_error("Too large shift step.");
+    shift_digits_left_in_place(_digits, shift_quotient, shift_remainder);
+    return *this;
+  }
+
+  BigInt shift_right(std::size_t shift_quotient,
+                     const Digit shift_remainder) const {
+    if (!*this)
+      return *this;
+    else if (shift_quotient >= MAX_DIGITS_COUNT)
+      return this->is_negative() ? ~BigInt() : BigInt();
+    else if (this->is_negative()) {
+      Digits digits =
+          shift_digits_right(_digits, shift_quotient, shift_remainder);
+      if (digits_have_bits_below(_digits, shift_quotient, shift_remainder))
+        sum_digits_in_place(digits, Digits({1}));
+      return BigInt(-1, std::move(digits));
+    } else {
+      auto digits =
+          shift_digits_right(_digits, shift_quotient, shift_remainder);
+      return BigInt(_sign * (digits.size() > 1 || digits[0] != 0),
+                    std::move(digits));
+    }
+  }
+
+  BigInt& shift_right_in_place(std::size_t shift_quotient,
+                               const Digit shift_remainder) {
+    if (!*this)
+      return *this;
+    else if (shift_quotient >= MAX_DIGITS_COUNT)
+      return *this = is_negative() ? ~BigInt() : BigInt();
+    else if (is_negative()) {
+      const bool has_bits_below =
+          digits_have_bits_below(_digits, shift_quotient, shift_remainder);
+      shift_digits_right_in_place(_digits, shift_quotient, shift_remainder);
+      if (has_bits_below) sum_digits_in_place(_digits, Digits({1}));
+    } else {
+      shift_digits_right_in_place(_digits, shift_quotient, shift_remainder);
+      _sign *= (_digits.size() > 1 || _digits[0] != 0);
+    }
+    return *this;
+  }
+
+  static std::size_t to_count(const BigInt& value) {
+    if (digits_bit_length(value._digits) >
+        std::numeric_limits<std::size_t>::digits)
+      throw std::overflow_error("Too large count.");
+    return safe_reduce_digits<std::size_t>(value._digits, 0);
+  }
+
+  static std::size_t to_shift_quotient(const BigInt& shift,
+                                       Digit& shift_remainder) {
+    if (shift.is_negative())
+      throw std::invalid_argument("Shift by negative step is undefined.");
+    Digits shift_quotient_digits;
+    shift_remainder = divrem_digits_by_digit(
+        shift._digits, static_cast<Digit>(BINARY_SHIFT), shift_quotient_digits);
+    return safe_reduce_digits<std::size_t>(shift_quotient_digits,
+                                           MAX_DIGITS_COUNT);
+  }
+
+  template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  static std::size_t to_shift_quotient(T shift, Digit& shift_remainder) {
+    if constexpr (std::is_signed_v<T>)
+      if (shift < 0)
+        throw std::invalid_argument("Shift by negative step is undefined.");
+    using Step = std::common_type_t<std::make_unsigned_t<T>, std::size_t>;
+    const Step step = static_cast<Step>(shift);
+    shift_remainder = static_cast<Digit>(step % BINARY_SHIFT);
+    return static_cast<std::size_t>(
+        std::min<Step>(step / BINARY_SHIFT, MAX_DIGITS_COUNT));
+  }
+
+  static BigInt binomial_by_primes(std::size_t total, std::size_t count) {
+    std::vector<std::uint64_t> factors;
+    std::uint64_t factor = 1;
+    const auto include = [&](std::size_t prime) {
+      std::uint64_t prime_power = 1;
+      bool borrow = false;
+      for (std::size_t total_rest = total, count_rest = count; total_rest;
+           total_rest /= prime, count_rest /= prime) {
+        borrow = total_rest % prime < count_rest % prime + borrow;
+        if (borrow) prime_power *= prime;
+      }
+      if (factor > std::numeric_limits<std::uint64_t>::max() / prime_power) {
+        factors.push_back(factor);
+        factor = prime_power;
+      } else
+        factor *= prime_power;
+    };
+    include(2);
+    std::vector<bool> is_composite(total / 2 + 1);
+    for (std::size_t prime = 3; prime <= total; prime += 2) {
+      if (is_composite[prime / 2]) continue;
+      include(prime);
+      if (prime <= total / prime)
+        for (std::size_t multiple = prime * prime; multiple <= total;
+             multiple += 2 * prime)
+          is_composite[multiple / 2] = true;
+    }
+    factors.push_back(factor);
+    return product_tree(factors.data(), factors.size());
+  }
+
+  template <bool BINOMIAL>
+  BigInt falling_factorial(std::size_t count) const {
+    if (!count) return BigInt(1);
+    const std::size_t bits_count = digits_bit_length(_digits);
+    if (count <= std::numeric_limits<std::uint64_t>::digits &&
+        bits_count * count <= std::numeric_limits<std::uint64_t>::digits) {
+      const auto value = safe_reduce_digits<std::uint64_t>(_digits, 0);
+      std::uint64_t result = 1, divisor = 1;
+      for (std::size_t index = 0; index < count; ++index) {
+        result *= value - index;
+        if constexpr (BINOMIAL) divisor *= index + 1;
+      }
+      return BigInt(result / divisor);
+    }
+    if (count == 1) return *this;
+    const std::size_t half = count / 2;
+    BigInt result =
+        falling_factorial<BINOMIAL>(half) *
+        (*this - half).template falling_factorial<BINOMIAL>(count - half);
+    if constexpr (BINOMIAL)
+      return result.divide_exact(
+          BigInt(count).template falling_factorial<true>(half));
+    else
+      return result;
+  }
+
+  static bool has_power_residues(const Digits& digits,
+                                 std::size_t degree) noexcept {
+    std::size_t checks_count = 0;
+    for (std::size_t modulus = 2 * degree + 1;
+         modulus <= BINARY_DIGIT_MASK &&
+         checks_count < POWER_RESIDUE_CHECKS_COUNT;
+         modulus += 2 * degree) {
+      if (!is_small_prime(modulus)) continue;
+      ++checks_count;
+      DoubleDigit residue = 0;
+      for (std::size_t index = digits.size(); index-- > 0;)
+        residue = ((residue << BINARY_SHIFT) | digits[index]) % modulus;
+      if (!residue) continue;
+      DoubleDigit power = 1;
+      for (std::size_t exponent = (modulus - 1) / degree; exponent;
+           exponent >>= 1) {
+        if (exponent & 1) power = power * residue % modulus;
+        residue = residue * residue % modulus;
+      }
+      if (power != 1) return false;
+    }
+    return true;
+  }
+
+  static bool is_small_prime(std::size_t value) noexcept {
+    if (value < 4) return value > 1;
+    if (!(value & 1)) return false;
+    for (std::size_t divisor = 3; divisor * divisor <= value; divisor += 2)
+      if (!(value % divisor)) return false;
+    return true;
+  }
+
+  static BigInt odd_range_product(std::size_t start, std::size_t stop,
+                                  std::size_t max_bits_count) {
+    const std::size_t count = (stop - start) / 2;
+    if (count <= std::numeric_limits<std::uint64_t>::digits / max_bits_count) {
+      std::uint64_t result = 1;
+      for (std::size_t factor = start; factor < stop; factor += 2)
+        result *= factor;
+      return BigInt(result);
+    }
+    const std::size_t middle = (start + count) | 1;
+    return odd_range_product(start, middle,
+                             cppbuiltins::bit_length(middle - 2)) *
+           odd_range_product(middle, stop, max_bits_count);
+  }
+
+  template <class Value>
+  static BigInt product_tree(const Value* values, std::size_t size) {
+    if (size <= 1) return size ? BigInt(values[0]) : BigInt(1);
+    const std::size_t half = size / 2;
+    return product_tree(values, half) *
+           product_tree(values + half, size - half);
+  }
+
+  double root_estimate(std::size_t degree, std::size_t& exponent) const {
+    constexpr std::size_t ESTIMATE_BITS_COUNT =
+        std::numeric_limits<std::uint64_t>::digits;
+    const std::size_t bits_count = digits_bit_length(_digits);
+    const std::size_t shift =
+        bits_count > ESTIMATE_BITS_COUNT ? bits_count - ESTIMATE_BITS_COUNT : 0;
+    int fraction_exponent;
+    const double fraction =
+        (*this >> shift).template frexp<double>(fraction_exponent);
+    const std::size_t value_exponent =
+        static_cast<std::size_t>(fraction_exponent) + shift;
+    exponent = value_exponent / degree;
+    return std::exp2(
+        (std::log2(fraction) + static_cast<double>(value_exponent % degree)) /
+        static_cast<double>(degree));
+  }
+
+  BigInt two_adic_root(std::size_t degree, std::size_t bits_count) const {
+    const BigInt value(1,
+                       slice_digits(_digits, 0, bits_count / BINARY_SHIFT + 1)),
+        degree_value(degree);
+    BigInt inverse_root(1u), degree_inverse(1u);
+    for (std::size_t precision = 1; precision < bits_count;) {
+      precision = std::min(2 * precision, bits_count);
+      const BigInt mask = (BigInt(1u) << precision) - 1;
+      const TruncationContext context(mask);
+      degree_inverse =
+          (degree_inverse * (BigInt(2u) - degree_value * degree_inverse)) &
+          mask;
+      const BigInt error =
+          BigInt(1u) -
+          ((value * exponentiate(context, inverse_root, degree_value._digits)) &
+           mask);
+      inverse_root =
+          (inverse_root + ((inverse_root * error) & mask) * degree_inverse) &
+          mask;
+    }
+    const BigInt mask = (BigInt(1u) << bits_count) - 1;
+    const TruncationContext context(mask);
+    return (value *
+            exponentiate(context, inverse_root, BigInt(degree - 1)._digits)) &
+           mask;
+  }
+
+  BigInt root_upper_estimate(std::size_t degree) const {
+    constexpr int MANTISSA_BITS_COUNT = std::numeric_limits<double>::digits - 1;
+    constexpr double SAFETY_FACTOR = 1.0 + 1.0 / (1ULL << 40);
+    std::size_t exponent;
+    const double fraction = root_estimate(degree, exponent) * SAFETY_FACTOR;
+    if (exponent <= static_cast<std::size_t>(MANTISSA_BITS_COUNT))
+      return BigInt(static_cast<std::uint64_t>(
+                        std::ldexp(fraction, static_cast<int>(exponent))) +
+                    1);
+    return BigInt(static_cast<std::uint64_t>(
+                      std::ldexp(fraction, MANTISSA_BITS_COUNT)) +
+                  1)
+           << (exponent - MANTISSA_BITS_COUNT);
+  }
+
+  void square_root_with_remainder(BigInt& root, BigInt& remainder) const {
+    const std::size_t bits_count = digits_bit_length(_digits);
+    if (bits_count <= SQUARE_ROOT_BASE_BITS_COUNT) {
+      const auto value = safe_reduce_digits<std::uint64_t>(_digits, 0);
+      auto result =
+          static_cast<std::uint64_t>(std::sqrt(static_cast<double>(value)));
+      while (result * result > value) --result;
+      while ((result + 1) * (result + 1) <= value) ++result;
+      root = BigInt(result);
+      remainder = BigInt(value - result * result);
+      return;
+    }
+    const std::size_t quarter_bits_count = (bits_count + 3) / 4;
+    const std::size_t normalization_shift =
+        (4 * quarter_bits_count - bits_count) / 2;
+    const BigInt normalized = *this << 2 * normalization_shift;
+    const BigInt quarter_mask = (BigInt(1) << quarter_bits_count) - 1;
+    BigInt high_root, high_remainder;
+    (normalized >> 2 * quarter_bits_count)
+        .square_root_with_remainder(high_root, high_remainder);
+    BigInt quotient, quotient_remainder;
+    ((high_remainder << quarter_bits_count) |
+     ((normalized >> quarter_bits_count) & quarter_mask))
+        .divmod(high_root << 1, quotient, quotient_remainder);
+    root = (high_root << quarter_bits_count) + quotient;
+    remainder = ((quotient_remainder << quarter_bits_count) |
+                 (normalized & quarter_mask)) -
+                quotient * quotient;
+    if (remainder.is_negative()) {
+      remainder += (root << 1) - 1;
+      root -= 1;
+    }
+    if (normalization_shift) {
+      root >>= normalization_shift;
+      remainder = *this - root * root;
+    }
+  }
+
   template <bool WITH_QUOTIENT, bool WITH_REMAINDER>
   void divmod(const BigInt& divisor, BigInt* quotient,
               BigInt* remainder) const {
@@ -1355,8 +3077,7 @@ class BigInt {
                (digits_count == divisor_digits_count &&
                 _digits.back() < divisor._digits.back())) {
       if (_sign != divisor._sign) {
-        if constexpr (WITH_QUOTIENT)
-          *quotient = BigInt(-1, std::vector<Digit>({1}));
+        if constexpr (WITH_QUOTIENT) *quotient = BigInt(-1, Digits({1}));
         if constexpr (WITH_REMAINDER) *remainder = *this + divisor;
       } else {
         if constexpr (WITH_QUOTIENT) *quotient = BigInt();
@@ -1365,33 +3086,32 @@ class BigInt {
     } else {
       Sign remainder_sign = _sign;
       if (divisor_digits_count == 1) {
-        std::vector<Digit> quotient_digits;
+        Digits quotient_digits;
         Digit remainder_digit = divrem_digits_by_digit(
             _digits, divisor._digits[0], quotient_digits);
         remainder_sign *= remainder_digit != 0;
         if constexpr (WITH_QUOTIENT)
-          *quotient = BigInt(_sign * divisor._sign, quotient_digits);
+          *quotient = BigInt(_sign * divisor._sign, std::move(quotient_digits));
         if constexpr (WITH_REMAINDER)
-          *remainder =
-              BigInt(remainder_sign, std::vector<Digit>{remainder_digit});
+          *remainder = BigInt(remainder_sign, Digits{remainder_digit});
       } else {
-        std::vector<Digit> quotient_digits, remainder_digits;
-        divrem_two_or_more_digits(_digits, divisor._digits, quotient_digits,
-                                  remainder_digits);
+        Digits quotient_digits, remainder_digits;
+        divrem_digits(_digits, divisor._digits, quotient_digits,
+                      remainder_digits);
         remainder_sign *=
             remainder_digits.size() > 1 || remainder_digits[0] != 0;
         if constexpr (WITH_QUOTIENT)
           *quotient = BigInt(
               _sign * divisor._sign *
                   (quotient_digits.size() > 1 || quotient_digits[0] != 0),
-              quotient_digits);
+              std::move(quotient_digits));
         if constexpr (WITH_REMAINDER)
-          *remainder = BigInt(remainder_sign, remainder_digits);
+          *remainder = BigInt(remainder_sign, std::move(remainder_digits));
       }
       if ((divisor._sign < 0 && remainder_sign > 0) ||
           (divisor._sign > 0 && remainder_sign < 0)) {
         if constexpr (WITH_QUOTIENT)
-          *quotient = *quotient - BigInt(1, std::vector<Digit>({1}));
+          *quotient = *quotient - BigInt(1, Digits({1}));
         if constexpr (WITH_REMAINDER) *remainder = *remainder + divisor;
       }
     }
@@ -1417,28 +3137,27 @@ class BigInt {
     } else {
       Sign remainder_sign = _sign;
       if (divisor_digits_count == 1) {
-        std::vector<Digit> quotient_digits;
+        Digits quotient_digits;
         Digit remainder_digit = divrem_digits_by_digit(
             _digits, divisor._digits[0], quotient_digits);
         remainder_sign *= remainder_digit != 0;
         if constexpr (WITH_QUOTIENT)
-          *quotient = BigInt(_sign * divisor._sign, quotient_digits);
+          *quotient = BigInt(_sign * divisor._sign, std::move(quotient_digits));
         if constexpr (WITH_REMAINDER)
-          *remainder =
-              BigInt(remainder_sign, std::vector<Digit>{remainder_digit});
+          *remainder = BigInt(remainder_sign, Digits{remainder_digit});
       } else {
-        std::vector<Digit> quotient_digits, remainder_digits;
-        divrem_two_or_more_digits(_digits, divisor._digits, quotient_digits,
-                                  remainder_digits);
+        Digits quotient_digits, remainder_digits;
+        divrem_digits(_digits, divisor._digits, quotient_digits,
+                      remainder_digits);
         remainder_sign *=
             remainder_digits.size() > 1 || remainder_digits[0] != 0;
         if constexpr (WITH_QUOTIENT)
           *quotient = BigInt(
               _sign * divisor._sign *
                   (quotient_digits.size() > 1 || quotient_digits[0] != 0),
-              quotient_digits);
+              std::move(quotient_digits));
         if constexpr (WITH_REMAINDER)
-          *remainder = BigInt(remainder_sign, remainder_digits);
+          *remainder = BigInt(remainder_sign, std::move(remainder_digits));
       }
     }
   }
@@ -1460,71 +3179,525 @@ class BigInt {
         exponent = -exponent;
         base = base.invmod(modulus);
       }
-      if (base.is_negative() || base.digits().size() > modulus.digits().size())
-        base = base.mod(modulus);
+      base = base.mod(modulus);
     } else if (exponent.is_negative())
       throw std::range_error(
           "Either exponent should be positive or modulus should be specified.");
-    const std::vector<Digit>& exponent_digits = exponent.digits();
-    Digit exponent_digit = exponent_digits.back();
-    std::size_t exponent_digits_count = exponent_digits.size();
-    BigInt result = BigInt(1u);
-    if (exponent_digits_count == 1 && exponent_digit <= 3) {
-      if (exponent_digit >= 2) {
-        result = (base * base).mod(modulus);
-        if (exponent_digit == 3) result = (result * base).mod(modulus);
-      } else if (exponent_digit == 1)
-        result = (base * result).mod(modulus);
-    } else if (exponent_digits_count <= WINDOW_CUTOFF) {
-      result = base;
-      Digit exponent_mask = 2;
-      for (;; exponent_mask <<= 1)
-        if (exponent_mask > exponent_digit) {
-          exponent_mask >>= 1;
-          break;
+    BigInt result;
+    if constexpr (!std::is_same<Modulus, NoModulus>()) {
+      if ((modulus._digits[0] & 1) &&
+          modulus._digits.size() <= MONTGOMERY_CUTOFF &&
+          (exponent._digits.size() > 1 || exponent._digits[0] > 3)) {
+        MontgomeryContext context(modulus._digits);
+        result = context.to_big_int(
+            exponentiate(context, context.to_value(base), exponent._digits));
+      } else {
+        DivisionContext<Modulus> context(modulus);
+        result = exponentiate(context, base, exponent._digits);
+      }
+      if (is_negative && result) result = result - modulus;
+    } else {
+      DivisionContext<Modulus> context(modulus);
+      result = exponentiate(context, base, exponent._digits);
+    }
+    return result;
+  }
+
+  template <class Modulus>
+  class DivisionContext {
+   public:
+    using Value = BigInt;
+
+    explicit DivisionContext(const Modulus& modulus) : _modulus(modulus) {}
+
+    BigInt one() const { return BigInt(1u); }
+
+    void multiply(const BigInt& first, const BigInt& second,
+                  BigInt& result) const {
+      result = (first * second).mod(_modulus);
+    }
+
+    void square(const BigInt& value, BigInt& result) const {
+      result = (value * value).mod(_modulus);
+    }
+
+   private:
+    Modulus _modulus;
+  };
+
+  class TruncationContext {
+   public:
+    using Value = BigInt;
+
+    explicit TruncationContext(const BigInt& mask) : _mask(mask) {}
+
+    BigInt one() const { return BigInt(1u); }
+
+    void multiply(const BigInt& first, const BigInt& second,
+                  BigInt& result) const {
+      result = (first * second) & _mask;
+    }
+
+    void square(const BigInt& value, BigInt& result) const {
+      result = (value * value) & _mask;
+    }
+
+   private:
+    const BigInt& _mask;
+  };
+
+  class BarrettContext {
+   public:
+    using Value = BigInt;
+
+    BarrettContext(const BigInt& modulus, const BigInt& reciprocal)
+        : _modulus(modulus), _reciprocal(reciprocal) {}
+
+    BigInt one() const { return BigInt(1u); }
+
+    void multiply(const BigInt& first, const BigInt& second,
+                  BigInt& result) const {
+      reduce(first * second, result);
+    }
+
+    const BigInt& to_big_int(const BigInt& value) const noexcept {
+      return value;
+    }
+
+    BigInt to_value(const BigInt& value) const {
+      BigInt result;
+      reduce(value, result);
+      return result;
+    }
+
+    void reduce(const BigInt& value, BigInt& result) const {
+      BigInt quotient;
+      if (_reciprocal)
+        value.divmod(_modulus, _reciprocal, quotient, result);
+      else
+        value.divmod(_modulus, quotient, result);
+    }
+
+    void square(const BigInt& value, BigInt& result) const {
+      reduce(value * value, result);
+    }
+
+   private:
+    const BigInt& _modulus;
+    const BigInt& _reciprocal;
+  };
+
+  class MontgomeryContext {
+   public:
+    using Value = Digits;
+
+    explicit MontgomeryContext(const Digits& modulus)
+        : _modulus(modulus),
+          _inverse(negated_inverse_digit(modulus[0])),
+          _product(2 * modulus.size() + 1),
+          _workspace(karatsuba_workspace_size(modulus.size(), modulus.size())) {
+    }
+
+    Value one() const { return to_value(BigInt(1u)); }
+
+    Value to_value(const BigInt& value) const {
+      const std::size_t size = _modulus.size();
+      Value result =
+          BigInt(value._sign, shift_digits_left(value._digits, size, 0))
+              .mod(BigInt(1, _modulus))
+              ._digits;
+      result.resize(size, 0);
+      return result;
+    }
+
+    BigInt to_big_int(const Value& value) {
+      std::copy(value.begin(), value.end(), _product.begin());
+      std::fill(_product.begin() + value.size(), _product.end(), 0);
+      Value result;
+      reduce(result);
+      trim_leading_zeros(result);
+      return BigInt(result.size() > 1 || result[0] != 0, std::move(result));
+    }
+
+    void multiply(const Value& first, const Value& second, Value& result) {
+      const std::size_t size = _modulus.size();
+      multiply_digits_karatsuba(first.data(), size, second.data(), size,
+                                _product.data(), _workspace.data());
+      _product[2 * size] = 0;
+      reduce(result);
+    }
+
+    void square(const Value& value, Value& result) {
+      const std::size_t size = _modulus.size();
+      square_digits_karatsuba(value.data(), size, _product.data(),
+                              _workspace.data());
+      _product[2 * size] = 0;
+      reduce(result);
+    }
+
+   private:
+    Digits _modulus;
+    Digit _inverse;
+    Digits _product, _workspace;
+
+    static Digit negated_inverse_digit(Digit digit) noexcept {
+      return (BINARY_BASE - inverse_digit(digit)) & BINARY_DIGIT_MASK;
+    }
+
+    void reduce(Value& result) noexcept {
+      const std::size_t size = _modulus.size();
+      Digit* const product = _product.data();
+      for (std::size_t index = 0; index < size; ++index) {
+        const DoubleDigit factor =
+            (product[index] * static_cast<DoubleDigit>(_inverse)) &
+            BINARY_DIGIT_MASK;
+        DoubleDigit accumulator = 0;
+        Digit* position = product + index;
+        for (const Digit digit : _modulus) {
+          accumulator += factor * digit + *position;
+          *(position++) = static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+          accumulator >>= BINARY_SHIFT;
         }
-      exponent_mask >>= 1;
-      for (auto exponent_digit_position = exponent_digits.rbegin();;) {
-        for (; exponent_mask != 0; exponent_mask >>= 1) {
-          result = (result * result).mod(modulus);
-          if (exponent_digit & exponent_mask)
-            result = (result * base).mod(modulus);
+        for (; accumulator; ++position) {
+          accumulator += *position;
+          *position = static_cast<Digit>(accumulator & BINARY_DIGIT_MASK);
+          accumulator >>= BINARY_SHIFT;
         }
-        if (++exponent_digit_position == exponent_digits.rend()) break;
-        exponent_digit = *exponent_digit_position;
-        exponent_mask = static_cast<Digit>(1) << (BINARY_SHIFT - 1);
       }
-    } else {
-      BigInt cache[WINDOW_BASE];
-      cache[0] = result;
-      for (std::size_t index = 1; index < WINDOW_BASE; ++index)
-        cache[index] = (cache[index - 1] * base).mod(modulus);
-      std::vector<WindowDigit> exponent_window_digits =
-          binary_digits_to_binary_base<Digit, WindowDigit, BINARY_SHIFT,
-                                       WINDOW_SHIFT>(exponent_digits);
-      for (auto exponent_digit_position = exponent_window_digits.rbegin();
-           exponent_digit_position != exponent_window_digits.rend();
-           ++exponent_digit_position) {
-        const WindowDigit digit = *exponent_digit_position;
-        for (std::size_t iteration = 0; iteration < WINDOW_SHIFT; ++iteration)
-          result = (result * result).mod(modulus);
-        if (digit) result = (result * cache[digit]).mod(modulus);
+      Digit* const high = product + size;
+      bool is_reducible = high[size] != 0;
+      if (!is_reducible) {
+        std::size_t index = size;
+        while (index > 0 && high[index - 1] == _modulus[index - 1]) --index;
+        is_reducible = index == 0 || high[index - 1] > _modulus[index - 1];
       }
+      if (is_reducible)
+        (void)subtract_digits_in_place(high, size + 1, _modulus.data(), size);
+      result.assign(high, high + size);
     }
-    if constexpr (!std::is_same<Modulus, NoModulus>()) {
-      if (is_negative && result) result = result - modulus;
+  };
+
+  using ExponentWindow = std::pair<std::size_t, std::size_t>;
+
+  template <class Context>
+  static typename Context::Value exponentiate(
+      Context& context, const typename Context::Value& base,
+      const Digits& exponent_digits) {
+    const std::size_t window_width =
+        std::is_same<Context, DivisionContext<NoModulus>>()
+            ? 1
+            : to_window_width(digits_bit_length(exponent_digits),
+                              value_size(base));
+    return exponentiate_windows(
+        context, base, to_exponent_windows(exponent_digits, window_width),
+        window_width);
+  }
+
+  template <class Context>
+  static typename Context::Value exponentiate_windows(
+      Context& context, const typename Context::Value& base,
+      const std::vector<ExponentWindow>& windows, std::size_t window_width) {
+    typename Context::Value result = context.one();
+    if (windows.empty()) return result;
+    const std::vector<typename Context::Value> cache =
+        odd_powers(context, base, window_width);
+    std::size_t position = windows[0].first;
+    result = cache[windows[0].second >> 1];
+    for (auto window = windows.begin() + 1; window != windows.end(); ++window) {
+      for (; position > window->first; --position)
+        context.square(result, result);
+      context.multiply(result, cache[window->second >> 1], result);
     }
+    for (; position > 0; --position) context.square(result, result);
     return result;
   }
 
+  template <class Context>
+  static typename Context::Value multi_exponentiate(
+      Context& context, const std::vector<typename Context::Value>& bases,
+      const std::vector<Digits>& exponents_digits) {
+    std::size_t bit_length = 0;
+    for (const Digits& exponent_digits : exponents_digits)
+      bit_length = std::max(bit_length, digits_bit_length(exponent_digits));
+    std::vector<std::vector<ExponentWindow>> windows_by_position(bit_length);
+    std::vector<std::vector<typename Context::Value>> caches;
+    caches.reserve(bases.size());
+    for (std::size_t index = 0; index < bases.size(); ++index) {
+      const std::size_t window_width = to_window_width(
+          digits_bit_length(exponents_digits[index]), value_size(bases[index]));
+      caches.push_back(odd_powers(context, bases[index], window_width));
+      for (const ExponentWindow& window :
+           to_exponent_windows(exponents_digits[index], window_width))
+        windows_by_position[window.first].emplace_back(index, window.second);
+    }
+    typename Context::Value result = context.one();
+    bool is_result_one = true;
+    for (std::size_t position = bit_length; position > 0; --position) {
+      if (!is_result_one) context.square(result, result);
+      for (const ExponentWindow& window : windows_by_position[position - 1]) {
+        const typename Context::Value& factor =
+            caches[window.first][window.second >> 1];
+        if (is_result_one) {
+          result = factor;
+          is_result_one = false;
+        } else
+          context.multiply(result, factor, result);
+      }
+    }
+    return result;
+  }
+
+  template <class Context>
+  static std::vector<typename Context::Value> odd_powers(
+      Context& context, const typename Context::Value& base,
+      std::size_t window_width) {
+    std::vector<typename Context::Value> result(
+        static_cast<std::size_t>(1) << (window_width - 1), base);
+    if (window_width > 1) {
+      typename Context::Value base_square;
+      context.square(base, base_square);
+      for (std::size_t index = 1; index < result.size(); ++index)
+        context.multiply(result[index - 1], base_square, result[index]);
+    }
+    return result;
+  }
+
+  static std::vector<ExponentWindow> to_exponent_windows(
+      const Digits& exponent_digits, std::size_t window_width) {
+    std::vector<ExponentWindow> result;
+    for (std::size_t position = digits_bit_length(exponent_digits);
+         position > 0;) {
+      if (!digits_bit(exponent_digits, position - 1)) {
+        --position;
+        continue;
+      }
+      std::size_t window_start =
+          position > window_width ? position - window_width : 0;
+      while (!digits_bit(exponent_digits, window_start)) ++window_start;
+      std::size_t window = 0;
+      for (std::size_t index = position; index > window_start; --index)
+        window = (window << 1) | digits_bit(exponent_digits, index - 1);
+      result.emplace_back(window_start, window);
+      position = window_start;
+    }
+    return result;
+  }
+
+  static std::size_t digits_bit_length(const Digits& digits) noexcept {
+    return (digits.size() - 1) * BINARY_SHIFT +
+           cppbuiltins::bit_length(digits.back());
+  }
+
+  static bool digits_bit(const Digits& digits, std::size_t position) noexcept {
+    return (digits[position / BINARY_SHIFT] >> (position % BINARY_SHIFT)) & 1;
+  }
+
+  static std::size_t to_window_width(std::size_t exponent_bit_length,
+                                     std::size_t operand_size) noexcept {
+    std::size_t result = 1;
+    for (const std::size_t cutoff : WINDOW_WIDTH_CUTOFFS)
+      result += exponent_bit_length > cutoff;
+    while (result > 1 && (operand_size << (result - 1)) > MAX_WINDOW_CACHE_SIZE)
+      --result;
+    return result;
+  }
+
+  static std::size_t value_size(const BigInt& value) noexcept {
+    return value._digits.size();
+  }
+
+  static std::size_t value_size(const Digits& value) noexcept {
+    return value.size();
+  }
+
   template <std::size_t BASE>
   std::vector<Digit> to_base_digits() const noexcept {
     if constexpr ((BASE & (BASE - 1)) == 0)
       return binary_digits_to_binary_base<Digit, Digit, BINARY_SHIFT,
                                           floor_log<2>(BASE)>(_digits);
-    else
+    else if (_digits.size() <= RADIX_CONVERSION_CUTOFF)
       return binary_digits_to_non_binary_base<Digit, Digit, BINARY_SHIFT, BASE>(
           _digits);
+    else {
+      std::size_t level = 0;
+      while (!digits_lesser_than(_digits, radix_power_digits(BASE, level + 1)))
+        ++level;
+      std::vector<Digit> result(static_cast<std::size_t>(2) << level, 0);
+      to_non_binary_base_digits<BASE>(_digits, level, result.data());
+      trim_leading_zeros(result);
+      return result;
+    }
+  }
+
+  template <std::size_t BASE>
+  static void to_non_binary_base_digits(const Digits& digits, std::size_t level,
+                                        Digit* result) noexcept {
+    if (digits.size() <= RADIX_CONVERSION_CUTOFF) {
+      const std::vector<Digit> base_digits =
+          binary_digits_to_non_binary_base<Digit, Digit, BINARY_SHIFT, BASE>(
+              digits);
+      std::copy(base_digits.begin(), base_digits.end(), result);
+      return;
+    }
+    const Digits& radix_power = radix_power_digits(BASE, level);
+    if (digits_lesser_than(digits, radix_power)) {
+      to_non_binary_base_digits<BASE>(digits, level - 1, result);
+      return;
+    }
+    Digits quotient, remainder;
+    divrem_digits(digits, radix_power, quotient, remainder);
+    to_non_binary_base_digits<BASE>(remainder, level - 1, result);
+    to_non_binary_base_digits<BASE>(
+        quotient, level - 1, result + (static_cast<std::size_t>(1) << level));
+  }
+
+  static Digits from_non_binary_base_digits(
+      const std::vector<unsigned char>& digits, std::size_t start,
+      std::size_t stop, std::size_t base) {
+    Digit radix = static_cast<Digit>(base);
+    std::size_t radix_exponent = 1;
+    for (; radix * base < BINARY_BASE; ++radix_exponent)
+      radix *= static_cast<Digit>(base);
+    const std::size_t size = stop - start;
+    if (size <= RADIX_CONVERSION_CUTOFF * radix_exponent) {
+      const std::vector<Digit> result =
+          binary_digits_from_non_binary_base<Digit, BINARY_SHIFT>(
+              std::vector<unsigned char>(digits.begin() + start,
+                                         digits.begin() + stop),
+              base);
+      return Digits(result.begin(), result.end());
+    }
+    std::size_t level = 0;
+    while ((radix_exponent << (level + 1)) < size) ++level;
+    const std::size_t middle = start + (radix_exponent << level);
+    return sum_digits(
+        multiply_digits(from_non_binary_base_digits(digits, middle, stop, base),
+                        radix_power_digits(radix, level)),
+        from_non_binary_base_digits(digits, start, middle, base));
+  }
+
+  static const Digits& radix_power_digits(Digit radix,
+                                          std::size_t level) noexcept {
+    static std::map<Digit, std::deque<Digits>> powers;
+    static std::mutex powers_mutex;
+    const std::lock_guard<std::mutex> lock(powers_mutex);
+    std::deque<Digits>& radix_powers = powers[radix];
+    if (radix_powers.empty()) radix_powers.push_back({radix});
+    while (radix_powers.size() <= level)
+      radix_powers.push_back(square_digits(radix_powers.back()));
+    return radix_powers[level];
+  }
+};
+
+template <class _Digit, char _SEPARATOR, std::size_t _BINARY_SHIFT>
+class BigInt<_Digit, _SEPARATOR, _BINARY_SHIFT>::ModulusContext {
+ public:
+  explicit ModulusContext(const BigInt& value)
+      : _value(value), _magnitude(value.abs()) {
+    if (!value) throw std::invalid_argument("Modulus cannot be zero.");
+    if (_magnitude._digits.size() > BARRETT_CUTOFF)
+      _reciprocal = _magnitude.reciprocal();
+    if ((_magnitude._digits[0] & 1) &&
+        _magnitude._digits.size() <= MONTGOMERY_CUTOFF)
+      _montgomery.emplace(_magnitude._digits);
+  }
+
+  BigInt multiply(const BigInt& first, const BigInt& second) const {
+    return reduce(first * second);
+  }
+
+  BigInt multi_power(const std::vector<BigInt>& bases,
+                     const std::vector<BigInt>& exponents) {
+    if (bases.size() != exponents.size())
+      throw std::invalid_argument(
+          "Bases and exponents should have the same length.");
+    if (_magnitude.is_one()) return BigInt();
+    std::vector<BigInt> normalized_bases;
+    std::vector<Digits> exponents_digits;
+    normalized_bases.reserve(bases.size());
+    exponents_digits.reserve(exponents.size());
+    for (std::size_t index = 0; index < bases.size(); ++index) {
+      const BigInt& exponent = exponents[index];
+      normalized_bases.push_back(exponent.is_negative()
+                                     ? bases[index].invmod(_magnitude)
+                                     : bases[index]);
+      exponents_digits.push_back(exponent._digits);
+    }
+    return to_signed(with_context([&](auto& context) {
+      std::vector<typename std::decay_t<decltype(context)>::Value> values;
+      values.reserve(normalized_bases.size());
+      for (const BigInt& base : normalized_bases)
+        values.push_back(context.to_value(base));
+      return context.to_big_int(
+          multi_exponentiate(context, values, exponents_digits));
+    }));
+  }
+
+  BigInt power(BigInt base, BigInt exponent) {
+    if (_magnitude.is_one()) return BigInt();
+    if (exponent.is_negative()) {
+      exponent = -exponent;
+      base = base.invmod(_magnitude);
+    }
+    if (exponent._digits.size() == 1 && exponent._digits[0] <= 3) {
+      BarrettContext context(_magnitude, _reciprocal);
+      return to_signed(
+          exponentiate(context, context.to_value(base), exponent._digits));
+    }
+    return to_signed(with_context([&](auto& context) {
+      return context.to_big_int(
+          exponentiate(context, context.to_value(base), exponent._digits));
+    }));
+  }
+
+  std::vector<BigInt> power_many(const std::vector<BigInt>& bases,
+                                 BigInt exponent) {
+    if (_magnitude.is_one()) return std::vector<BigInt>(bases.size());
+    const bool is_inverted = exponent.is_negative();
+    if (is_inverted) exponent = -exponent;
+    const std::size_t window_width = to_window_width(
+        digits_bit_length(exponent._digits), _magnitude._digits.size());
+    const std::vector<ExponentWindow> windows =
+        to_exponent_windows(exponent._digits, window_width);
+    std::vector<BigInt> result;
+    result.reserve(bases.size());
+    with_context([&](auto& context) {
+      for (const BigInt& base : bases)
+        result.push_back(to_signed(context.to_big_int(exponentiate_windows(
+            context,
+            context.to_value(is_inverted ? base.invmod(_magnitude) : base),
+            windows, window_width))));
+    });
+    return result;
+  }
+
+  BigInt reduce(const BigInt& value) const {
+    BigInt quotient, result;
+    if (_reciprocal)
+      value.divmod(_value, _reciprocal, quotient, result);
+    else
+      value.divmod(_value, quotient, result);
+    return result;
+  }
+
+  BigInt square(const BigInt& value) const { return reduce(value * value); }
+
+  const BigInt& value() const noexcept { return _value; }
+
+ private:
+  BigInt _value, _magnitude, _reciprocal;
+  std::optional<MontgomeryContext> _montgomery;
+
+  BigInt to_signed(BigInt value) const {
+    if (_value.is_negative() && value) value = value - _magnitude;
+    return value;
+  }
+
+  template <class Function>
+  auto with_context(const Function& function) {
+    if (_montgomery) return function(*_montgomery);
+    BarrettContext context(_magnitude, _reciprocal);
+    return function(context);
   }
 };
 }  // namespace cppbuiltins
@@ -2,8 +2,14 @@
 #define DIGITS_HPP
 
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 #include "utils.h"
 
 namespace cppbuiltins {
@@ -63,9 +69,10 @@ static constexpr bool is_space(char character) noexcept {
 
 template <class SourceDigit, class TargetDigit, std::size_t TARGET_SHIFT,
           TargetDigit TARGET_DIGIT_MASK =
-              cppbuiltins::const_power(TargetDigit(2), TARGET_SHIFT) - 1>
+              cppbuiltins::const_power(TargetDigit(2), TARGET_SHIFT) - 1,
+          class SourceDigits = std::vector<SourceDigit>>
 static std::vector<TargetDigit> binary_digits_to_greater_binary_base(
-    const std::vector<SourceDigit>& source, std::size_t source_shift) noexcept {
+    const SourceDigits& source, std::size_t source_shift) noexcept {
   const std::size_t result_digits_count = static_cast<std::size_t>(
       (source.size() * TARGET_SHIFT + TARGET_SHIFT - 1) / TARGET_SHIFT);
   std::vector<TargetDigit> result;
@@ -89,9 +96,10 @@ static std::vector<TargetDigit> binary_digits_to_greater_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t SOURCE_SHIFT,
-          std::size_t TARGET_SHIFT>
+          std::size_t TARGET_SHIFT,
+          class SourceDigits = std::vector<SourceDigit>>
 static std::vector<TargetDigit> binary_digits_to_greater_binary_base(
-    const std::vector<SourceDigit>& source) noexcept {
+    const SourceDigits& source) noexcept {
   static_assert(SOURCE_SHIFT < TARGET_SHIFT,
                 "Target base should be greater than a source one.");
   return binary_digits_to_greater_binary_base<SourceDigit, TargetDigit,
@@ -100,9 +108,10 @@ static std::vector<TargetDigit> binary_digits_to_greater_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t TARGET_SHIFT,
-          std::size_t TARGET_DIGIT_MASK = (TargetDigit(1) << TARGET_SHIFT) - 1>
+          std::size_t TARGET_DIGIT_MASK = (TargetDigit(1) << TARGET_SHIFT) - 1,
+          class SourceDigits = std::vector<SourceDigit>>
 static std::vector<TargetDigit> binary_digits_to_lesser_binary_base(
-    const std::vector<SourceDigit>& source, std::size_t source_shift) noexcept {
+    const SourceDigits& source, std::size_t source_shift) noexcept {
   const std::size_t result_digits_bits_count =
       ((source.size() - 1) * source_shift + bit_length(source.back()));
   const std::size_t result_digits_count = static_cast<std::size_t>(
@@ -129,9 +138,10 @@ static std::vector<TargetDigit> binary_digits_to_lesser_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t SOURCE_SHIFT,
-          std::size_t TARGET_SHIFT>
+          std::size_t TARGET_SHIFT,
+          class SourceDigits = std::vector<SourceDigit>>
 static std::vector<TargetDigit> binary_digits_to_lesser_binary_base(
-    const std::vector<SourceDigit>& source) noexcept {
+    const SourceDigits& source) noexcept {
   static_assert(SOURCE_SHIFT > TARGET_SHIFT,
                 "Target base should be lesser than a source one.");
   return binary_digits_to_lesser_binary_base<SourceDigit, TargetDigit,
@@ -140,9 +150,10 @@ static std::vector<TargetDigit> binary_digits_to_lesser_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t SOURCE_SHIFT,
-          std::size_t TARGET_SHIFT>
+          std::size_t TARGET_SHIFT,
+          class SourceDigits = std::vector<SourceDigit>>
 std::vector<TargetDigit> binary_digits_to_binary_base(
-    const std::vector<SourceDigit>& source) noexcept {
+    const SourceDigits& source) noexcept {
   if constexpr (SOURCE_SHIFT < TARGET_SHIFT)
     return binary_digits_to_greater_binary_base<SourceDigit, TargetDigit,
                                                 SOURCE_SHIFT, TARGET_SHIFT>(
@@ -152,13 +163,14 @@ std::vector<TargetDigit> binary_digits_to_binary_base(
                                                SOURCE_SHIFT, TARGET_SHIFT>(
         source);
   else
-    return source;
+    return std::vector<TargetDigit>(source.begin(), source.end());
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t SOURCE_SHIFT,
-          std::size_t TARGET_BASE>
+          std::size_t TARGET_BASE,
+          class SourceDigits = std::vector<SourceDigit>>
 static std::vector<TargetDigit> binary_digits_to_non_binary_base(
-    const std::vector<SourceDigit>& source) noexcept {
+    const SourceDigits& source) noexcept {
   std::size_t result_max_digits_count =
       1 + static_cast<std::size_t>(source.size() * SOURCE_SHIFT /
                                    std::log2(TARGET_BASE));
@@ -189,7 +201,7 @@ static std::vector<TargetDigit> binary_digits_to_non_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t TARGET_SHIFT,
-          std::size_t TARGET_BASE = const_power(2, TARGET_SHIFT),
+          std::size_t TARGET_BASE = const_power(std::size_t(2), TARGET_SHIFT),
           std::size_t TARGET_DIGIT_MASK = TARGET_BASE - 1>
 static std::vector<TargetDigit> non_binary_digits_to_greater_binary_base(
     const std::vector<SourceDigit>& source, std::size_t source_base) {
@@ -233,7 +245,7 @@ static std::vector<TargetDigit> non_binary_digits_to_greater_binary_base(
 }
 
 template <class SourceDigit, class TargetDigit, std::size_t TARGET_SHIFT,
-          std::size_t TARGET_BASE = const_power(2, TARGET_SHIFT),
+          std::size_t TARGET_BASE = const_power(std::size_t(2), TARGET_SHIFT),
           std::size_t TARGET_DIGIT_MASK = TARGET_BASE - 1>
 static std::vector<TargetDigit> non_binary_digits_to_lesser_binary_base(
     const std::vector<SourceDigit>& source, std::size_t source_base) {
@@ -262,34 +274,213 @@ static std::vector<TargetDigit> non_binary_digits_to_lesser_binary_base(
   return result;
 }
 
-template <class Digit>
-static void trim_leading_zeros(std::vector<Digit>& digits) noexcept {
+template <class Digits>
+static void trim_leading_zeros(Digits& digits) noexcept {
   std::size_t digits_count = digits.size();
   while (digits_count > 1 && digits[digits_count - 1] == 0) --digits_count;
   if (digits_count != digits.size()) digits.resize(digits_count);
 }
 
-template <typename Digit>
-static bool digits_lesser_than(const std::vector<Digit>& first,
-                               const std::vector<Digit>& second) noexcept {
+template <class Digits>
+static bool digits_lesser_than(const Digits& first,
+                               const Digits& second) noexcept {
   return first.size() < second.size() ||
          (first.size() == second.size() &&
           std::lexicographical_compare(first.rbegin(), first.rend(),
                                        second.rbegin(), second.rend()));
 }
 
-template <typename Digit>
-static bool digits_lesser_than_or_equal(
-    const std::vector<Digit>& first,
-    const std::vector<Digit>& second) noexcept {
+template <class Digits>
+static bool digits_lesser_than_or_equal(const Digits& first,
+                                        const Digits& second) noexcept {
   return first.size() < second.size() ||
          (first.size() == second.size() &&
           !std::lexicographical_compare(second.rbegin(), second.rend(),
                                         first.rbegin(), first.rend()));
 }
 
+#if defined(__GNUC__) && defined(__x86_64__)
+template <class Digit>
+struct Avx2Lanes;
+
+template <>
+struct Avx2Lanes<std::uint32_t> {
+  static constexpr std::size_t COUNT = 8;
+
+  __attribute__((target("avx2"))) static __m256i add(__m256i first,
+                                                     __m256i second) noexcept {
+    return _mm256_add_epi32(first, second);
+  }
+
+  __attribute__((target("avx2"))) static __m256i broadcast(
+      std::uint32_t value) noexcept {
+    return _mm256_set1_epi32(static_cast<int>(value));
+  }
+
+  __attribute__((target("avx2"))) static std::uint32_t last(
+      __m256i lanes) noexcept {
+    return static_cast<std::uint32_t>(_mm256_extract_epi32(lanes, 7));
+  }
+
+  __attribute__((target("avx2"))) static __m256i shift_in(
+      __m256i lanes, std::uint32_t value) noexcept {
+    return _mm256_blend_epi32(
+        _mm256_permutevar8x32_epi32(lanes,
+                                    _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6)),
+        _mm256_setr_epi32(static_cast<int>(value), 0, 0, 0, 0, 0, 0, 0), 0x01);
+  }
+
+  __attribute__((target("avx2"))) static __m256i shift_right(
+      __m256i lanes, int shift) noexcept {
+    return _mm256_srli_epi32(lanes, shift);
+  }
+
+  __attribute__((target("avx2"))) static __m256i subtract(
+      __m256i minuend, __m256i subtrahend) noexcept {
+    return _mm256_sub_epi32(minuend, subtrahend);
+  }
+};
+
+template <>
+struct Avx2Lanes<std::uint64_t> {
+  static constexpr std::size_t COUNT = 4;
+
+  __attribute__((target("avx2"))) static __m256i add(__m256i first,
+                                                     __m256i second) noexcept {
+    return _mm256_add_epi64(first, second);
+  }
+
+  __attribute__((target("avx2"))) static __m256i broadcast(
+      std::uint64_t value) noexcept {
+    return _mm256_set1_epi64x(static_cast<long long>(value));
+  }
+
+  __attribute__((target("avx2"))) static std::uint64_t last(
+      __m256i lanes) noexcept {
+    return static_cast<std::uint64_t>(_mm256_extract_epi64(lanes, 3));
+  }
+
+  __attribute__((target("avx2"))) static __m256i shift_in(
+      __m256i lanes, std::uint64_t value) noexcept {
+    return _mm256_blend_epi32(
+        _mm256_permute4x64_epi64(lanes, 0x90),
+        _mm256_set_epi64x(0, 0, 0, static_cast<long long>(value)), 0x03);
+  }
+
+  __attribute__((target("avx2"))) static __m256i shift_right(
+      __m256i lanes, int shift) noexcept {
+    return _mm256_srli_epi64(lanes, shift);
+  }
+
+  __attribute__((target("avx2"))) static __m256i subtract(
+      __m256i minuend, __m256i subtrahend) noexcept {
+    return _mm256_sub_epi64(minuend, subtrahend);
+  }
+};
+
+static bool is_avx2_supported() noexcept {
+  static const bool result = __builtin_cpu_supports("avx2");
+  return result;
+}
+
+template <class Digit, std::size_t BINARY_SHIFT>
+__attribute__((target("avx2"))) static std::size_t sum_digits_avx2(
+    const Digit* first, const Digit* second, std::size_t size, Digit* result,
+    Digit& accumulator) noexcept {
+  using Lanes = Avx2Lanes<Digit>;
+  constexpr Digit BINARY_DIGIT_MASK = (Digit(1) << BINARY_SHIFT) - 1;
+  const __m256i digit_mask = Lanes::broadcast(BINARY_DIGIT_MASK);
+  const __m256i overflow_mask = Lanes::broadcast(~BINARY_DIGIT_MASK);
+  std::size_t index = 0;
+  for (; index + Lanes::COUNT <= size; index += Lanes::COUNT) {
+    const __m256i sum = Lanes::add(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + index)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + index)));
+    const __m256i carries = Lanes::shift_right(sum, BINARY_SHIFT);
+    const __m256i step = Lanes::add(_mm256_and_si256(sum, digit_mask),
+                                    Lanes::shift_in(carries, accumulator));
+    if (_mm256_testz_si256(step, overflow_mask)) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), step);
+      accumulator = Lanes::last(carries);
+    } else
+      for (std::size_t offset = index; offset < index + Lanes::COUNT;
+           ++offset) {
+        accumulator += first[offset] + second[offset];
+        result[offset] = accumulator & BINARY_DIGIT_MASK;
+        accumulator >>= BINARY_SHIFT;
+      }
+  }
+  return index;
+}
+
+template <class Digit, std::size_t BINARY_SHIFT>
+__attribute__((target("avx2"))) static std::size_t subtract_digits_avx2(
+    const Digit* minuend, const Digit* subtrahend, std::size_t size,
+    Digit* result, Digit& accumulator) noexcept {
+  using Lanes = Avx2Lanes<Digit>;
+  constexpr Digit BINARY_DIGIT_MASK = (Digit(1) << BINARY_SHIFT) - 1;
+  const __m256i digit_mask = Lanes::broadcast(BINARY_DIGIT_MASK);
+  const __m256i overflow_mask = Lanes::broadcast(~BINARY_DIGIT_MASK);
+  const __m256i borrow_mask = Lanes::broadcast(1);
+  std::size_t index = 0;
+  for (; index + Lanes::COUNT <= size; index += Lanes::COUNT) {
+    const __m256i difference = Lanes::subtract(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(minuend + index)),
+        _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(subtrahend + index)));
+    const __m256i borrows = _mm256_and_si256(
+        Lanes::shift_right(difference, BINARY_SHIFT), borrow_mask);
+    const __m256i step =
+        Lanes::subtract(_mm256_and_si256(difference, digit_mask),
+                        Lanes::shift_in(borrows, accumulator));
+    if (_mm256_testz_si256(step, overflow_mask)) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), step);
+      accumulator = Lanes::last(borrows);
+    } else
+      for (std::size_t offset = index; offset < index + Lanes::COUNT;
+           ++offset) {
+        accumulator = minuend[offset] - subtrahend[offset] - accumulator;
+        result[offset] = accumulator & BINARY_DIGIT_MASK;
+        accumulator >>= BINARY_SHIFT;
+        accumulator &= 1;
+      }
+  }
+  return index;
+}
+#endif
+
+template <class Digit, std::size_t BINARY_SHIFT>
+static std::size_t sum_digits_vectorized(const Digit* first,
+                                         const Digit* second, std::size_t size,
+                                         Digit* result,
+                                         Digit& accumulator) noexcept {
+#if defined(__GNUC__) && defined(__x86_64__)
+  if constexpr (std::is_same_v<Digit, std::uint32_t> ||
+                std::is_same_v<Digit, std::uint64_t>)
+    if (is_avx2_supported())
+      return sum_digits_avx2<Digit, BINARY_SHIFT>(first, second, size, result,
+                                                  accumulator);
+#endif
+  return 0;
+}
+
+template <class Digit, std::size_t BINARY_SHIFT>
+static std::size_t subtract_digits_vectorized(const Digit* minuend,
+                                              const Digit* subtrahend,
+                                              std::size_t size, Digit* result,
+                                              Digit& accumulator) noexcept {
+#if defined(__GNUC__) && defined(__x86_64__)
+  if constexpr (std::is_same_v<Digit, std::uint32_t> ||
+                std::is_same_v<Digit, std::uint64_t>)
+    if (is_avx2_supported())
+      return subtract_digits_avx2<Digit, BINARY_SHIFT>(
+          minuend, subtrahend, size, result, accumulator);
+#endif
+  return 0;
+}
+
 template <class Digit, std::size_t BINARY_SHIFT,
-          std::size_t BINARY_BASE = const_power(2, BINARY_SHIFT)>
+          std::size_t BINARY_BASE = const_power(std::size_t(2), BINARY_SHIFT)>
 static std::vector<Digit> binary_digits_from_binary_base(
     const std::vector<unsigned char>& source,
     std::size_t source_shift) noexcept {
@@ -309,7 +500,7 @@ static std::vector<Digit> binary_digits_from_binary_base(
 }
 
 template <class Digit, std::size_t BINARY_SHIFT,
-          std::size_t BINARY_BASE = const_power(2, BINARY_SHIFT)>
+          std::size_t BINARY_BASE = const_power(std::size_t(2), BINARY_SHIFT)>
 static std::vector<Digit> binary_digits_from_non_binary_base(
     const std::vector<unsigned char>& source, std::size_t source_base) {
   if constexpr (BINARY_BASE >= MAX_REPRESENTABLE_BASE) {
@@ -341,9 +532,9 @@ static std::vector<unsigned char> parse_digits(
   return result;
 }
 
-template <class Digit, char SEPARATOR, std::size_t BINARY_SHIFT>
-static std::vector<Digit> parse_binary_digits(const char* start,
-                                              std::size_t base) {
+template <char SEPARATOR>
+static std::vector<unsigned char> parse_base_digits(const char* start,
+                                                    std::size_t& base) {
   if (base == 0) {
     if (start[0] != '0')
       base = 10;
@@ -387,8 +578,14 @@ static std::vector<Digit> parse_binary_digits(const char* start,
   while ((*start == '0' && start + 1 < stop) || *start == SEPARATOR) {
     ++start;
   }
-  std::vector<unsigned char> digits =
-      parse_digits<SEPARATOR>(start, stop, digits_count);
+  return parse_digits<SEPARATOR>(start, stop, digits_count);
+}
+
+template <class Digit, char SEPARATOR, std::size_t BINARY_SHIFT>
+static std::vector<Digit> parse_binary_digits(const char* start,
+                                              std::size_t base) {
+  const std::vector<unsigned char> digits =
+      parse_base_digits<SEPARATOR>(start, base);
   std::vector<Digit> result =
       (base & (base - 1))
           ? binary_digits_from_non_binary_base<Digit, BINARY_SHIFT>(digits,
@@ -40,9 +40,9 @@ class Fraction {
  public:
   Fraction() : _numerator(Component()), _denominator(Component(1)) {}
 
-  explicit Fraction(ConstParameterFrom<Component> numerator,
-                    ConstParameterFrom<Component> denominator = Component(1))
-      : Fraction(numerator, denominator, std::true_type{}) {}
+  explicit Fraction(Component numerator, Component denominator = Component(1))
+      : Fraction(std::move(numerator), std::move(denominator),
+                 std::true_type{}) {}
 
   Fraction operator+(const Fraction& other) const {
     return Fraction(
@@ -123,13 +123,13 @@ class Fraction {
     ConstParameterFrom<Component> other_numerator_denominator_gcd =
         gcd(_denominator, other._numerator);
     return Fraction(
-        cppbuiltins::floor_divide<Component>(_numerator,
+        cppbuiltins::divide_exact<Component>(_numerator,
                                              numerator_other_denominator_gcd) *
-            cppbuiltins::floor_divide<Component>(
+            cppbuiltins::divide_exact<Component>(
                 other._numerator, other_numerator_denominator_gcd),
-        cppbuiltins::floor_divide<Component>(_denominator,
+        cppbuiltins::divide_exact<Component>(_denominator,
                                              other_numerator_denominator_gcd) *
-            cppbuiltins::floor_divide<Component>(
+            cppbuiltins::divide_exact<Component>(
                 other._denominator, numerator_other_denominator_gcd),
         std::false_type{});
   }
@@ -137,9 +137,9 @@ class Fraction {
   Fraction operator*(ConstParameterFrom<Component> other) const {
     ConstParameterFrom<Component> denominator_other_gcd =
         gcd(_denominator, other);
-    return Fraction(_numerator * cppbuiltins::floor_divide<Component>(
+    return Fraction(_numerator * cppbuiltins::divide_exact<Component>(
                                      other, denominator_other_gcd),
-                    cppbuiltins::floor_divide<Component>(_denominator,
+                    cppbuiltins::divide_exact<Component>(_denominator,
                                                          denominator_other_gcd),
                     std::false_type{});
   }
@@ -166,19 +166,19 @@ class Fraction {
     ConstParameterFrom<Component> denominators_gcd =
         gcd(_denominator, other._denominator);
     return Fraction(
-        cppbuiltins::floor_divide<Component>(_numerator, numerators_gcd) *
-            cppbuiltins::floor_divide<Component>(other._denominator,
+        cppbuiltins::divide_exact<Component>(_numerator, numerators_gcd) *
+            cppbuiltins::divide_exact<Component>(other._denominator,
                                                  denominators_gcd),
-        cppbuiltins::floor_divide<Component>(other._numerator, numerators_gcd) *
-            cppbuiltins::floor_divide<Component>(_denominator,
+        cppbuiltins::divide_exact<Component>(other._numerator, numerators_gcd) *
+            cppbuiltins::divide_exact<Component>(_denominator,
                                                  denominators_gcd));
   }
 
   Fraction operator/(ConstParameterFrom<Component> other) const {
     ConstParameterFrom<Component> numerators_gcd = gcd(_numerator, other);
     return Fraction(
-        cppbuiltins::floor_divide<Component>(_numerator, numerators_gcd),
-        cppbuiltins::floor_divide<Component>(other, numerators_gcd) *
+        cppbuiltins::divide_exact<Component>(_numerator, numerators_gcd),
+        cppbuiltins::divide_exact<Component>(other, numerators_gcd) *
             _denominator);
   }
 
@@ -245,22 +245,21 @@ class Fraction {
   Component _numerator, _denominator;
 
   template <bool NORMALIZE>
-  Fraction(ConstParameterFrom<Component>& numerator,
-           ConstParameterFrom<Component>& denominator,
+  Fraction(Component numerator, Component denominator,
            std::bool_constant<NORMALIZE>)
-      : _numerator(numerator), _denominator(denominator) {
+      : _numerator(std::move(numerator)), _denominator(std::move(denominator)) {
     if constexpr (NORMALIZE) {
       if (!_denominator) throw ZeroDivisionError();
       if (cppbuiltins::is_negative<Component>(_denominator)) {
-        _numerator = -_numerator;
-        _denominator = -_denominator;
+        _numerator = -std::move(_numerator);
+        _denominator = -std::move(_denominator);
       }
       Component components_gcd = gcd(_numerator, _denominator);
       if (!cppbuiltins::is_one<Component>(components_gcd)) {
         _denominator =
-            cppbuiltins::floor_divide<Component>(_denominator, components_gcd);
+            cppbuiltins::divide_exact<Component>(_denominator, components_gcd);
         _numerator =
-            cppbuiltins::floor_divide<Component>(_numerator, components_gcd);
+            cppbuiltins::divide_exact<Component>(_numerator, components_gcd);
       }
     }
   }
@@ -318,9 +317,9 @@ Fraction<Component, Gcd> operator*(ConstParameterFrom<Component> self,
                                    const Fraction<Component, Gcd>& other) {
   const Component self_other_denominator_gcd = self.gcd(other.denominator());
   return Fraction<Component, Gcd>(
-      cppbuiltins::floor_divide<Component>(self, self_other_denominator_gcd) *
+      cppbuiltins::divide_exact<Component>(self, self_other_denominator_gcd) *
           other.numerator(),
-      cppbuiltins::floor_divide<Component>(other.denominator(),
+      cppbuiltins::divide_exact<Component>(other.denominator(),
                                            self_other_denominator_gcd));
 }
 
@@ -329,9 +328,9 @@ Fraction<Component, Gcd> operator/(ConstParameterFrom<Component> self,
                                    const Fraction<Component, Gcd>& other) {
   const Component self_other_numerator_gcd = self.gcd(other.numerator());
   return Fraction<Component, Gcd>(
-      cppbuiltins::floor_divide<Component>(self, self_other_numerator_gcd) *
+      cppbuiltins::divide_exact<Component>(self, self_other_numerator_gcd) *
           other.denominator(),
-      cppbuiltins::floor_divide<Component>(other.numerator(),
+      cppbuiltins::divide_exact<Component>(other.numerator(),
                                            self_other_numerator_gcd));
 }
 
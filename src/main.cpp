@@ -29,6 +29,7 @@ namespace py = pybind11;
 #define LIST_ITERATOR_NAME "list_iterator"
 #define LIST_NAME "list"
 #define LIST_REVERSED_ITERATOR_NAME "list_reversed_iterator"
+#define MODULUS_NAME "Modulus"
 #define SET_ITERATOR_NAME "set_iterator"
 #define SET_NAME "set"
 #ifndef VERSION_INFO
@@ -112,8 +113,12 @@ static std::string to_repr(const Type& value) {
   return {stream.str()};
 }
 
+#ifdef __SIZEOF_INT128__
+using BaseInt = cppbuiltins::BigInt<std::uint64_t, '_'>;
+#else
 using BaseInt = cppbuiltins::BigInt<
     std::conditional_t<sizeof(void*) == 8, std::uint32_t, std::uint16_t>, '_'>;
+#endif
 
 static int int_to_sign(const py::int_& value) {
   PyLongObject* ptr = (PyLongObject*)value.ptr();
@@ -121,13 +126,15 @@ static int int_to_sign(const py::int_& value) {
   return signed_size < 0 ? -1 : signed_size > 0;
 }
 
-static std::vector<BaseInt::Digit> int_to_digits(const py::int_& value) {
+static BaseInt::Digits int_to_digits(const py::int_& value) {
   PyLongObject* ptr = (PyLongObject*)value.ptr();
   Py_ssize_t signed_size = Py_SIZE(ptr);
   std::size_t size = Py_ABS(signed_size) + (signed_size == 0);
-  return cppbuiltins::binary_digits_to_binary_base<
-      digit, BaseInt::Digit, PyLong_SHIFT, BaseInt::BINARY_SHIFT>(
-      std::vector<digit>(ptr->ob_digit, ptr->ob_digit + size));
+  const std::vector<BaseInt::Digit> result =
+      cppbuiltins::binary_digits_to_binary_base<
+          digit, BaseInt::Digit, PyLong_SHIFT, BaseInt::BINARY_SHIFT>(
+          std::vector<digit>(ptr->ob_digit, ptr->ob_digit + size));
+  return BaseInt::Digits(result.begin(), result.end());
 }
 
 static const char* pystr_to_ascii_c_str(const py::str& string) {
@@ -153,6 +160,8 @@ class Int : public BaseInt {
 
   explicit Int(const BaseInt& value) : BaseInt(value) {}
 
+  explicit Int(BaseInt&& value) noexcept : BaseInt(std::move(value)) {}
+
   explicit Int(const py::object& value) : Int(object_to_py_long(value)) {}
 
   explicit Int(const py::int_& value)
@@ -169,46 +178,198 @@ class Int : public BaseInt {
 
   const Int& operator+() const noexcept { return *this; }
 
-  Int operator+(const Int& other) const noexcept {
+  Int operator+(const Int& other) const& noexcept {
     return Int(BaseInt::operator+(other));
   }
 
-  Int operator&(const Int& other) const noexcept {
+  Int operator+(const Int& other) && noexcept {
+    *this += other;
+    return std::move(*this);
+  }
+
+  Int& operator+=(const Int& other) noexcept {
+    BaseInt::operator+=(other);
+    return *this;
+  }
+
+  Int operator+(Py_ssize_t other) const& noexcept {
+    return Int(BaseInt::operator+(other));
+  }
+
+  Int operator+(Py_ssize_t other) && noexcept {
+    *this += other;
+    return std::move(*this);
+  }
+
+  Int& operator+=(Py_ssize_t other) noexcept {
+    BaseInt::operator+=(other);
+    return *this;
+  }
+
+  Int operator&(const Int& other) const& noexcept {
     return Int(BaseInt::operator&(other));
   }
 
+  Int operator&(const Int& other) && noexcept {
+    *this &= other;
+    return std::move(*this);
+  }
+
+  Int& operator&=(const Int& other) noexcept {
+    BaseInt::operator&=(other);
+    return *this;
+  }
+
   Int operator~() const noexcept { return Int(BaseInt::operator~()); }
 
-  Int operator*(const Int& other) const noexcept {
+  Int operator*(const Int& other) const& noexcept {
     return Int(BaseInt::operator*(other));
   }
 
-  Int operator-() const noexcept { return Int(BaseInt::operator-()); }
+  Int operator*(const Int& other) && noexcept {
+    *this *= other;
+    return std::move(*this);
+  }
+
+  Int& operator*=(const Int& other) noexcept {
+    BaseInt::operator*=(other);
+    return *this;
+  }
+
+  Int operator*(Py_ssize_t other) const& noexcept {
+    return Int(BaseInt::operator*(other));
+  }
+
+  Int operator*(Py_ssize_t other) && noexcept {
+    *this *= other;
+    return std::move(*this);
+  }
+
+  Int& operator*=(Py_ssize_t other) noexcept {
+    BaseInt::operator*=(other);
+    return *this;
+  }
+
+  Int operator-() const& noexcept { return Int(BaseInt::operator-()); }
+
+  Int operator-() && noexcept { return Int(-static_cast<BaseInt&&>(*this)); }
+
+  Int operator-(const Int& other) const& noexcept {
+    return Int(BaseInt::operator-(other));
+  }
+
+  Int operator-(const Int& other) && noexcept {
+    *this -= other;
+    return std::move(*this);
+  }
 
-  Int operator-(const Int& other) const noexcept {
+  Int& operator-=(const Int& other) noexcept {
+    BaseInt::operator-=(other);
+    return *this;
+  }
+
+  Int operator-(Py_ssize_t other) const& noexcept {
     return Int(BaseInt::operator-(other));
   }
 
-  Int operator|(const Int& other) const noexcept {
+  Int operator-(Py_ssize_t other) && noexcept {
+    *this -= other;
+    return std::move(*this);
+  }
+
+  Int& operator-=(Py_ssize_t other) noexcept {
+    BaseInt::operator-=(other);
+    return *this;
+  }
+
+  Int operator|(const Int& other) const& noexcept {
     return Int(BaseInt::operator|(other));
   }
 
-  Int operator^(const Int& other) const noexcept {
+  Int operator|(const Int& other) && noexcept {
+    *this |= other;
+    return std::move(*this);
+  }
+
+  Int& operator|=(const Int& other) noexcept {
+    BaseInt::operator|=(other);
+    return *this;
+  }
+
+  Int operator^(const Int& other) const& noexcept {
     return Int(BaseInt::operator^(other));
   }
 
-  Int operator<<(const Int& other) const {
+  Int operator^(const Int& other) && noexcept {
+    *this ^= other;
+    return std::move(*this);
+  }
+
+  Int& operator^=(const Int& other) noexcept {
+    BaseInt::operator^=(other);
+    return *this;
+  }
+
+  Int operator<<(const Int& other) const& {
     return Int(BaseInt::operator<<(other));
   }
 
-  Int operator>>(const Int& other) const {
+  Int operator<<(const Int& other) && {
+    *this <<= other;
+    return std::move(*this);
+  }
+
+  Int& operator<<=(const Int& other) {
+    BaseInt::operator<<=(other);
+    return *this;
+  }
+
+  Int operator<<(Py_ssize_t other) const& {
+    return Int(BaseInt::operator<<(other));
+  }
+
+  Int operator<<(Py_ssize_t other) && {
+    *this <<= other;
+    return std::move(*this);
+  }
+
+  Int& operator<<=(Py_ssize_t other) {
+    BaseInt::operator<<=(other);
+    return *this;
+  }
+
+  Int operator>>(const Int& other) const& {
     return Int(BaseInt::operator>>(other));
   }
 
+  Int operator>>(const Int& other) && {
+    *this >>= other;
+    return std::move(*this);
+  }
+
+  Int& operator>>=(const Int& other) {
+    BaseInt::operator>>=(other);
+    return *this;
+  }
+
+  Int operator>>(Py_ssize_t other) const& {
+    return Int(BaseInt::operator>>(other));
+  }
+
+  Int operator>>(Py_ssize_t other) && {
+    *this >>= other;
+    return std::move(*this);
+  }
+
+  Int& operator>>=(Py_ssize_t other) {
+    BaseInt::operator>>=(other);
+    return *this;
+  }
+
   Int abs() const noexcept { return Int(BaseInt::abs()); }
 
   PyLongObject* as_PyLong() const noexcept {
-    const std::vector<BaseInt::Digit>& digits = this->digits();
+    const BaseInt::Digits& digits = this->digits();
     std::vector<digit> result_digits =
         cppbuiltins::binary_digits_to_binary_base<
             BaseInt::Digit, digit, BaseInt::BINARY_SHIFT, PyLong_SHIFT>(digits);
@@ -225,6 +386,14 @@ class Int : public BaseInt {
 
   Int bit_length() const noexcept { return Int(BaseInt::bit_length()); }
 
+  Int comb(const Int& count) const { return Int(BaseInt::comb(count)); }
+
+  Int divide_exact(const Int& divisor) const {
+    return Int(BaseInt::divide_exact(divisor));
+  }
+
+  Int factorial() const { return Int(BaseInt::factorial()); }
+
   Int floor_divide(const Int& divisor) const {
     return Int(BaseInt::floor_divide(divisor));
   }
@@ -232,8 +401,10 @@ class Int : public BaseInt {
   Int gcd(const Int& other) const { return Int(BaseInt::gcd(other)); }
 
   Py_hash_t hash() const noexcept {
-    const std::vector<BaseInt::Digit>& digits = this->digits();
-    if (digits.size() == 1) {
+    static constexpr std::size_t HASH_ROTATION =
+        BaseInt::BINARY_SHIFT % _PyHASH_BITS;
+    const BaseInt::Digits& digits = this->digits();
+    if (digits.size() == 1 && digits[0] < _PyHASH_MODULUS) {
       if (is_positive())
         return digits[0];
       else if (is_negative())
@@ -244,10 +415,10 @@ class Int : public BaseInt {
     Py_uhash_t result = 0;
     for (auto position = digits.rbegin(); position != digits.rend();
          ++position) {
-      result = ((result << BaseInt::BINARY_SHIFT) & _PyHASH_MODULUS) |
-               (result >> (_PyHASH_BITS - BaseInt::BINARY_SHIFT));
-      result += *position;
-      if (result >= _PyHASH_MODULUS) result -= _PyHASH_MODULUS;
+      result = ((result << HASH_ROTATION) & _PyHASH_MODULUS) |
+               (result >> (_PyHASH_BITS - HASH_ROTATION));
+      result += (*position & _PyHASH_MODULUS) + (*position >> _PyHASH_BITS);
+      while (result >= _PyHASH_MODULUS) result -= _PyHASH_MODULUS;
     }
     result = is_negative() ? -result : result;
     result -= (result == std::numeric_limits<Py_uhash_t>::max());
@@ -256,8 +427,18 @@ class Int : public BaseInt {
 
   Int invmod(const Int& divisor) const { return Int(BaseInt::invmod(divisor)); }
 
+  Int iroot(const Int& degree) const { return Int(BaseInt::iroot(degree)); }
+
+  bool is_perfect_power() const { return BaseInt::is_perfect_power(); }
+
+  Int isqrt() const { return Int(BaseInt::isqrt()); }
+
+  Int lcm(const Int& other) const { return Int(BaseInt::lcm(other)); }
+
   Int mod(const Int& divisor) const { return Int(BaseInt::mod(divisor)); }
 
+  Int perm(const Int& count) const { return Int(BaseInt::perm(count)); }
+
   Int power(const Int& exponent) const { return Int(BaseInt::power(exponent)); }
 
   Int power_modulo(const Int& exponent, const Int& modulus) const {
@@ -267,10 +448,39 @@ class Int : public BaseInt {
   std::string repr() const noexcept { return BaseInt::repr<10>(); }
 };
 
+static Int operator+(Py_ssize_t first, const Int& second) noexcept {
+  return second + first;
+}
+
+static Int operator*(Py_ssize_t first, const Int& second) noexcept {
+  return second * first;
+}
+
+static Int operator-(Py_ssize_t first, const Int& second) noexcept {
+  return -(second - first);
+}
+
+static bool operator<(Py_ssize_t first, const Int& second) noexcept {
+  return second > first;
+}
+
+static bool operator<=(Py_ssize_t first, const Int& second) noexcept {
+  return second >= first;
+}
+
 static std::ostream& operator<<(std::ostream& stream, const Int& value) {
   return stream << C_STR(MODULE_NAME) "." INT_NAME "('" << value.repr() << "')";
 }
 
+static Int object_to_int(const py::handle& value) {
+  if (py::isinstance<Int>(value)) return value.cast<Int>();
+  if (py::isinstance<py::int_>(value))
+    return Int(py::reinterpret_borrow<py::int_>(value));
+  throw py::type_error(
+      "Value should be an integer but found `" +
+      py::type::of(value).attr("__qualname__").cast<std::string>() + "`.");
+}
+
 namespace cppbuiltins {
 template <>
 double divide_as_double<Int>(ConstParameterFrom<Int> dividend,
@@ -332,6 +542,52 @@ static std::ostream& operator<<(std::ostream& stream, const Fraction& value) {
                 << ", " << value.denominator() << ")";
 }
 
+class Modulus {
+ public:
+  explicit Modulus(const Int& value) : _context(value) {}
+
+  Int mul(const Int& first, const Int& second) const {
+    return Int(_context.multiply(first, second));
+  }
+
+  Int multi_pow(const py::iterable& bases, const py::iterable& exponents) {
+    return Int(_context.multi_power(iterable_to_ints(bases),
+                                    iterable_to_ints(exponents)));
+  }
+
+  Int pow(const Int& base, const Int& exponent) {
+    return Int(_context.power(base, exponent));
+  }
+
+  py::list pow_many(const py::iterable& bases, const Int& exponent) {
+    py::list result;
+    for (const BaseInt& value :
+         _context.power_many(iterable_to_ints(bases), exponent))
+      result.append(Int(value));
+    return result;
+  }
+
+  Int reduce(const Int& value) const { return Int(_context.reduce(value)); }
+
+  Int square(const Int& value) const { return Int(_context.square(value)); }
+
+  Int value() const { return Int(_context.value()); }
+
+ private:
+  BaseInt::ModulusContext _context;
+
+  static std::vector<BaseInt> iterable_to_ints(const py::iterable& values) {
+    std::vector<BaseInt> result;
+    for (const auto& value : values) result.push_back(object_to_int(value));
+    return result;
+  }
+};
+
+static std::ostream& operator<<(std::ostream& stream, const Modulus& value) {
+  return stream << C_STR(MODULE_NAME) "." MODULUS_NAME "(" << value.value()
+                << ")";
+}
+
 template <class Iterable>
 IterableState iterable_to_state(const Iterable& self) {
   IterableState result;
@@ -1095,7 +1351,64 @@ PYBIND11_MODULE(MODULE_NAME, m) {
     }
   });
 
-  m.def("gcd", &Int::gcd);
+  m.def("comb", &Int::comb, py::arg("value"), py::arg("count"));
+  m.def("factorial", &Int::factorial, py::arg("value"));
+  m.def("gcd", [](const py::args& values) {
+    Int result;
+    for (const auto& value : values) {
+      result = result.gcd(object_to_int(value));
+      if (result.is_one()) break;
+    }
+    return result;
+  });
+  m.def("iroot", &Int::iroot, py::arg("value"), py::arg("degree"));
+  m.def("is_perfect_power", &Int::is_perfect_power, py::arg("value"));
+  m.def("isqrt", &Int::isqrt, py::arg("value"));
+  m.def("lcm", [](const py::args& values) {
+    Int result(BaseInt(1));
+    for (const auto& value : values) {
+      result = result.lcm(object_to_int(value));
+      if (!result) break;
+    }
+    return result;
+  });
+  m.def(
+      "multi_pow",
+      [](const py::iterable& bases, const py::iterable& exponents,
+         const Int& modulus) {
+        return Modulus(modulus).multi_pow(bases, exponents);
+      },
+      py::arg("bases"), py::arg("exponents"), py::arg("modulus"));
+  m.def("perm", &Int::factorial, py::arg("value"));
+  m.def("perm", &Int::perm, py::arg("value"), py::arg("count"));
+  m.def(
+      "pow_many",
+      [](const py::iterable& bases, const Int& exponent, const Int& modulus) {
+        return Modulus(modulus).pow_many(bases, exponent);
+      },
+      py::arg("bases"), py::arg("exponent"), py::arg("modulus"));
+  m.def(
+      "prod",
+      [](const py::iterable& values, const py::object& start) {
+        std::vector<BaseInt> factors{object_to_int(start)};
+        for (const auto& value : values)
+          factors.push_back(object_to_int(value));
+        return Int(BaseInt::product(factors));
+      },
+      py::arg("values"), py::arg("start") = 1);
+  m.def(
+      "sum",
+      [](const py::iterable& values, const py::object& start) {
+        Int result = object_to_int(start);
+        for (const auto& value : values) result += object_to_int(value);
+        return result;
+      },
+      py::arg("values"), py::arg("start") = 0);
+  m.def("xgcd", [](const Int& first, const Int& second) {
+    Int first_coefficient, second_coefficient;
+    const Int result(first.xgcd(second, first_coefficient, second_coefficient));
+    return py::make_tuple(result, first_coefficient, second_coefficient);
+  });
 
   static const Int ONE{1};
 
@@ -1110,19 +1423,32 @@ PYBIND11_MODULE(MODULE_NAME, m) {
       .def(py::init<const py::object&>(), py::arg("value"))
       .def("bit_length", &Int::bit_length)
       .def(py::self + py::self)
+      .def(py::self + Py_ssize_t{})
+      .def(Py_ssize_t{} + py::self)
       .def(py::self & py::self)
       .def(py::self == py::self)
+      .def(py::self == Py_ssize_t{})
       .def(~py::self)
       .def(py::self <= py::self)
+      .def(py::self <= Py_ssize_t{})
+      .def(Py_ssize_t{} <= py::self)
       .def(py::self < py::self)
+      .def(py::self < Py_ssize_t{})
+      .def(Py_ssize_t{} < py::self)
       .def(py::self * py::self)
+      .def(py::self * Py_ssize_t{})
+      .def(Py_ssize_t{} * py::self)
       .def(-py::self)
       .def(+py::self)
       .def(py::self - py::self)
+      .def(py::self - Py_ssize_t{})
+      .def(Py_ssize_t{} - py::self)
       .def(py::self | py::self)
       .def(py::self ^ py::self)
       .def(py::self << py::self)
+      .def(py::self << Py_ssize_t{})
       .def(py::self >> py::self)
+      .def(py::self >> Py_ssize_t{})
       .def(py::pickle([](const Int& self) { return py::int_(self); },
                       [](const py::int_& state) { return Int(state); }))
       .def("__abs__", &Int::abs)
@@ -1293,6 +1619,19 @@ PYBIND11_MODULE(MODULE_NAME, m) {
 
   Rational.attr("register")(PyFraction);
 
+  py::class_<Modulus>(m, MODULUS_NAME)
+      .def(py::init<const Int&>(), py::arg("value"))
+      .def("__repr__", &to_repr<Modulus>)
+      .def("mul", &Modulus::mul, py::arg("first"), py::arg("second"))
+      .def("multi_pow", &Modulus::multi_pow, py::arg("bases"),
+           py::arg("exponents"))
+      .def("pow", &Modulus::pow, py::arg("base"), py::arg("exponent"))
+      .def("pow_many", &Modulus::pow_many, py::arg("bases"),
+           py::arg("exponent"))
+      .def("reduce", &Modulus::reduce, py::arg("value"))
+      .def("square", &Modulus::square, py::arg("value"))
+      .def_property_readonly("value", &Modulus::value);
+
   py::class_<List> PyList(m, LIST_NAME);
   PyList.def(py::init<py::iterable>(), py::arg("values"))
       .def(py::self == py::self)
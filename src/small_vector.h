@@ -0,0 +1,225 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+namespace cppbuiltins {
+template <class T, std::size_t INLINE_CAPACITY>
+class SmallVector {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Elements should be trivially copyable.");
+  static_assert(INLINE_CAPACITY * sizeof(T) >= sizeof(T*),
+                "Inline storage should be able to hold a pointer.");
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  SmallVector() noexcept : _size(0), _capacity(INLINE_CAPACITY) {}
+
+  explicit SmallVector(size_type size) : SmallVector(size, T()) {}
+
+  SmallVector(size_type size, const T& value) : SmallVector() {
+    reserve(size);
+    std::fill_n(data(), size, value);
+    _size = size;
+  }
+
+  template <class Iterator,
+            std::enable_if_t<!std::is_integral_v<Iterator>, int> = 0>
+  SmallVector(Iterator first, Iterator last) : SmallVector() {
+    assign(first, last);
+  }
+
+  SmallVector(std::initializer_list<T> values)
+      : SmallVector(values.begin(), values.end()) {}
+
+  SmallVector(const SmallVector& other) : SmallVector() {
+    assign(other.begin(), other.end());
+  }
+
+  SmallVector(SmallVector&& other) noexcept : SmallVector() { steal(other); }
+
+  ~SmallVector() { release(); }
+
+  SmallVector& operator=(const SmallVector& other) {
+    if (this != &other) assign(other.begin(), other.end());
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other) noexcept {
+    if (this != &other) {
+      release();
+      _size = 0;
+      _capacity = INLINE_CAPACITY;
+      steal(other);
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(std::initializer_list<T> values) {
+    assign(values.begin(), values.end());
+    return *this;
+  }
+
+  bool operator==(const SmallVector& other) const noexcept {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+  }
+
+  bool operator!=(const SmallVector& other) const noexcept {
+    return !(*this == other);
+  }
+
+  T& operator[](size_type index) noexcept { return data()[index]; }
+
+  const T& operator[](size_type index) const noexcept { return data()[index]; }
+
+  void assign(size_type size, const T& value) {
+    if (size > _capacity) {
+      release();
+      _heap = allocate(size);
+      _capacity = size;
+    }
+    std::fill_n(data(), size, value);
+    _size = size;
+  }
+
+  template <class Iterator,
+            std::enable_if_t<!std::is_integral_v<Iterator>, int> = 0>
+  void assign(Iterator first, Iterator last) {
+    const size_type size = static_cast<size_type>(std::distance(first, last));
+    if (size > _capacity) {
+      T* const heap = allocate(size);
+      std::copy(first, last, heap);
+      release();
+      _heap = heap;
+      _capacity = size;
+    } else
+      std::copy(first, last, data());
+    _size = size;
+  }
+
+  T& back() noexcept { return data()[_size - 1]; }
+
+  const T& back() const noexcept { return data()[_size - 1]; }
+
+  iterator begin() noexcept { return data(); }
+
+  const_iterator begin() const noexcept { return data(); }
+
+  size_type capacity() const noexcept { return _capacity; }
+
+  void clear() noexcept { _size = 0; }
+
+  T* data() noexcept { return is_inline() ? _buffer : _heap; }
+
+  const T* data() const noexcept { return is_inline() ? _buffer : _heap; }
+
+  bool empty() const noexcept { return _size == 0; }
+
+  iterator end() noexcept { return data() + _size; }
+
+  const_iterator end() const noexcept { return data() + _size; }
+
+  T& front() noexcept { return data()[0]; }
+
+  const T& front() const noexcept { return data()[0]; }
+
+  void pop_back() noexcept { --_size; }
+
+  void push_back(const T& value) {
+    if (_size == _capacity) {
+      const T copy = value;
+      grow(_size + 1);
+      data()[_size++] = copy;
+    } else
+      data()[_size++] = value;
+  }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  void reserve(size_type capacity) {
+    if (capacity > _capacity) reallocate(capacity);
+  }
+
+  void resize(size_type size) { resize(size, T()); }
+
+  void resize(size_type size, const T& value) {
+    if (size > _size) {
+      reserve(size);
+      std::fill(data() + _size, data() + size, value);
+    }
+    _size = size;
+  }
+
+  size_type size() const noexcept { return _size; }
+
+ private:
+  size_type _size;
+  size_type _capacity;
+  union {
+    T* _heap;
+    T _buffer[INLINE_CAPACITY];
+  };
+
+  static T* allocate(size_type capacity) {
+    return static_cast<T*>(::operator new(capacity * sizeof(T)));
+  }
+
+  void grow(size_type capacity) {
+    reallocate(std::max(capacity, 2 * _capacity));
+  }
+
+  bool is_inline() const noexcept { return _capacity == INLINE_CAPACITY; }
+
+  void reallocate(size_type capacity) {
+    T* const heap = allocate(capacity);
+    std::copy(begin(), end(), heap);
+    release();
+    _heap = heap;
+    _capacity = capacity;
+  }
+
+  void release() noexcept {
+    if (!is_inline()) ::operator delete(_heap);
+  }
+
+  void steal(SmallVector& other) noexcept {
+    if (other.is_inline())
+      std::copy(other.begin(), other.end(), _buffer);
+    else {
+      _heap = other._heap;
+      _capacity = other._capacity;
+      other._capacity = INLINE_CAPACITY;
+    }
+    _size = other._size;
+    other._size = 0;
+  }
+};
+}  // namespace cppbuiltins
+
+#endif
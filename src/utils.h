@@ -10,13 +10,12 @@
 namespace cppbuiltins {
 template <class T, class U>
 struct is_upcastable
-    : std::integral_constant<
-          bool, std::is_arithmetic_v<T> && std::is_arithmetic_v<U> &&
-                    std::is_integral_v<T> == std::is_integral_v<U> &&
-                    std::numeric_limits<T>::is_specialized &&
-                    std::numeric_limits<U>::is_specialized &&
-                    std::numeric_limits<T>::digits <=
-                        std::numeric_limits<U>::digits> {};
+    : std::integral_constant<bool, std::numeric_limits<T>::is_specialized &&
+                                       std::numeric_limits<U>::is_specialized &&
+                                       std::numeric_limits<T>::is_integer ==
+                                           std::numeric_limits<U>::is_integer &&
+                                       std::numeric_limits<T>::digits <=
+                                           std::numeric_limits<U>::digits> {};
 
 template <class T, class U>
 constexpr bool is_upcastable_v = is_upcastable<T, U>::value;
@@ -43,9 +42,31 @@ struct DoublePrecision<std::uint32_t> {
   using type = std::uint64_t;
 };
 
+#ifdef __SIZEOF_INT128__
+template <>
+struct DoublePrecision<std::uint64_t> {
+  using type = unsigned __int128;
+};
+#endif
+
 template <class T>
 using DoublePrecisionOf = typename DoublePrecision<T>::type;
 
+template <class T>
+struct Signed {
+  using type = std::make_signed_t<T>;
+};
+
+#ifdef __SIZEOF_INT128__
+template <>
+struct Signed<unsigned __int128> {
+  using type = __int128;
+};
+#endif
+
+template <class T>
+using SignedOf = typename Signed<T>::type;
+
 template <class T>
 using ConstParameterFrom =
     std::conditional_t<std::is_arithmetic_v<T>, const T, const T&>;
@@ -85,6 +106,28 @@ double divide_as_double(ConstParameterFrom<Number> dividend,
   return dividend / divisor;
 }
 
+template <
+    class Dividend, class Divisor = Dividend,
+    std::enable_if_t<
+        std::is_integral_v<Dividend> && std::is_integral_v<Divisor>, int> = 0>
+Dividend divide_exact(ConstParameterFrom<Dividend> dividend,
+                      ConstParameterFrom<Divisor> divisor) {
+  return dividend / divisor;
+}
+
+template <
+    class Dividend, class Divisor = Dividend,
+    std::enable_if_t<
+        std::is_same_v<std::invoke_result_t<decltype(&Dividend::divide_exact),
+                                            ConstParameterFrom<Dividend>,
+                                            ConstParameterFrom<Divisor>>,
+                       Dividend>,
+        int> = 0>
+Dividend divide_exact(ConstParameterFrom<Dividend> dividend,
+                      ConstParameterFrom<Divisor> divisor) {
+  return dividend.divide_exact(divisor);
+}
+
 template <class Dividend, class Divisor = Dividend,
           std::enable_if_t<std::is_integral_v<Dividend> &&
                                std::is_integral_v<Divisor> &&
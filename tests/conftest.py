@@ -1,3 +1,5 @@
+import sys
+
 from hypothesis import (HealthCheck,
                         Verbosity,
                         settings)
@@ -7,3 +9,6 @@ settings.register_profile('default',
                           suppress_health_check=[HealthCheck.filter_too_much,
                                                  HealthCheck.too_slow],
                           verbosity=Verbosity.verbose)
+
+if hasattr(sys, 'set_int_max_str_digits'):
+    sys.set_int_max_str_digits(0)
@@ -1,4 +1,5 @@
 import sys
+from random import Random
 
 from hypothesis import strategies
 
@@ -9,10 +10,33 @@ from tests.utils import to_alternative_native_ints_pair
 decimal_int_strings_with_leading_zeros = decimal_int_strings_with_leading_zeros
 int_strings_with_bases = int_strings_with_bases
 ints_pairs = strategies.integers().map(to_alternative_native_ints_pair)
+ints_pairs_lists = strategies.lists(ints_pairs, max_size=5)
+
+
+def to_huge_int(seed: int, bit_length: int, negative: bool) -> int:
+    result = Random(seed).getrandbits(bit_length)
+    return -result if negative else result
+
+
+huge_ints_pairs = (strategies.builds(to_huge_int, strategies.integers(),
+                                     strategies.integers(30000, 600000),
+                                     strategies.booleans())
+                   .map(to_alternative_native_ints_pair))
+large_ints_pairs = (strategies.builds(to_huge_int, strategies.integers(),
+                                      strategies.integers(3000, 60000),
+                                      strategies.booleans())
+                    .map(to_alternative_native_ints_pair))
+machine_ints = strategies.integers(-sys.maxsize - 1, sys.maxsize)
 non_zero_ints_pairs = (strategies.integers().filter(bool)
                        .map(to_alternative_native_ints_pair))
-single_byte_ints_pairs = (strategies.integers(-128, 127)
-                          .map(to_alternative_native_ints_pair))
+root_degrees_pairs = (strategies.integers(1, 100)
+                      .map(to_alternative_native_ints_pair))
+small_root_degrees_pairs = (strategies.integers(2, 7)
+                            .map(to_alternative_native_ints_pair))
+single_byte_ints = strategies.integers(-128, 127)
+small_ints_pairs = (strategies.integers(-10, 3000)
+                    .map(to_alternative_native_ints_pair))
+single_byte_ints_pairs = single_byte_ints.map(to_alternative_native_ints_pair)
 exponents_with_moduli_pairs = (
         strategies.tuples(single_byte_ints_pairs,
                           strategies.tuples(strategies.none(),
@@ -1,7 +1,8 @@
 from hypothesis import given
 
 from tests.utils import (AlternativeNativeIntsPair,
-                         are_alternative_native_ints_equal)
+                         are_alternative_native_ints_equal,
+                         to_alternative_native_ints_pair)
 from . import strategies
 
 
@@ -15,3 +16,41 @@ def test_basic(first_pair: AlternativeNativeIntsPair,
     native_result = native_first + native_second
 
     assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+
+@given(strategies.large_ints_pairs)
+def test_carry_chain(pair: AlternativeNativeIntsPair) -> None:
+    _, native = pair
+    native_second = abs(native) + 1
+    native_first = (1 << native_second.bit_length()) - native_second
+    alternative_first, native_first = to_alternative_native_ints_pair(
+            native_first)
+    alternative_second, native_second = to_alternative_native_ints_pair(
+            native_second)
+
+    alternative_result = alternative_first + alternative_second
+    native_result = native_first + native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+@given(strategies.ints_pairs, strategies.machine_ints)
+def test_machine_int(first_pair: AlternativeNativeIntsPair,
+                     second: int) -> None:
+    alternative_first, native_first = first_pair
+
+    alternative_result = alternative_first + second
+    native_result = native_first + second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.machine_ints, strategies.ints_pairs)
+def test_reflected_machine_int(first: int,
+                               second_pair: AlternativeNativeIntsPair) -> None:
+    alternative_second, native_second = second_pair
+
+    alternative_result = first + alternative_second
+    native_result = first + native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
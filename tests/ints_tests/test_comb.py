@@ -0,0 +1,46 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_comb,
+                         are_alternative_native_ints_equal,
+                         native_comb)
+from . import strategies
+
+
+@given(strategies.small_ints_pairs, strategies.small_ints_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair,
+               counts_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+    alternative_count, native_count = counts_pair
+
+    try:
+        alternative_result = alternative_comb(alternative_value,
+                                              alternative_count)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_comb(native_value, native_count)
+    else:
+        native_result = native_comb(native_value, native_count)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
+
+
+@given(strategies.ints_pairs, strategies.small_ints_pairs)
+def test_large_value(values_pair: AlternativeNativeIntsPair,
+                     counts_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+    alternative_count, native_count = counts_pair
+
+    try:
+        alternative_result = alternative_comb(alternative_value,
+                                              alternative_count)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_comb(native_value, native_count)
+    else:
+        native_result = native_comb(native_value, native_count)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
@@ -26,3 +26,20 @@ def test_basic(dividends_pair: AlternativeNativeIntsPair,
                                                  native_quotient)
         assert are_alternative_native_ints_equal(alternative_remainder,
                                                  native_remainder)
+
+
+@given(strategies.huge_ints_pairs, strategies.huge_ints_pairs)
+def test_huge(dividends_pair: AlternativeNativeIntsPair,
+              divisors_pair: AlternativeNativeIntsPair) -> None:
+    alternative_dividend, native_dividend = dividends_pair
+    alternative_divisor, native_divisor = divisors_pair
+
+    alternative_quotient, alternative_remainder = divmod(
+            alternative_dividend * alternative_dividend, alternative_divisor)
+    native_quotient, native_remainder = divmod(
+            native_dividend * native_dividend, native_divisor)
+
+    assert are_alternative_native_ints_equal(alternative_quotient,
+                                             native_quotient)
+    assert are_alternative_native_ints_equal(alternative_remainder,
+                                             native_remainder)
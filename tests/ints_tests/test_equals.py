@@ -13,3 +13,11 @@ def test_basic(first_pair: AlternativeNativeIntsPair,
 
     assert equivalence(alternative_first == alternative_second,
                        native_first == native_second)
+
+
+@given(strategies.ints_pairs, strategies.machine_ints)
+def test_machine_int(first_pair: AlternativeNativeIntsPair,
+                     second: int) -> None:
+    alternative_first, native_first = first_pair
+
+    assert equivalence(alternative_first == second, native_first == second)
@@ -0,0 +1,24 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_factorial,
+                         are_alternative_native_ints_equal,
+                         native_factorial)
+from . import strategies
+
+
+@given(strategies.small_ints_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+
+    try:
+        alternative_result = alternative_factorial(alternative_value)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_factorial(native_value)
+    else:
+        native_result = native_factorial(native_value)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
@@ -1,9 +1,12 @@
+from typing import List
+
 from hypothesis import given
 
 from tests.utils import (AlternativeNativeIntsPair,
                          alternative_gcd,
                          are_alternative_native_ints_equal,
-                         native_gcd)
+                         native_gcd,
+                         to_alternative_native_ints_pair)
 from . import strategies
 
 
@@ -17,3 +20,49 @@ def test_basic(firsts_pair: AlternativeNativeIntsPair,
     native_result = native_gcd(native_first, native_second)
 
     assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.large_ints_pairs, strategies.large_ints_pairs,
+       strategies.large_ints_pairs)
+def test_large(firsts_pair: AlternativeNativeIntsPair,
+              seconds_pair: AlternativeNativeIntsPair,
+              factors_pair: AlternativeNativeIntsPair) -> None:
+    alternative_first, native_first = firsts_pair
+    alternative_second, native_second = seconds_pair
+    alternative_factor, native_factor = factors_pair
+
+    alternative_result = alternative_gcd(
+            alternative_first * alternative_factor,
+            alternative_second * alternative_factor)
+    native_result = native_gcd(native_first * native_factor,
+                               native_second * native_factor)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+
+def test_half_gcd() -> None:
+    alternative_first, native_first = to_alternative_native_ints_pair(
+            strategies.to_huge_int(0, 300000, False))
+    alternative_second, native_second = to_alternative_native_ints_pair(
+            strategies.to_huge_int(1, 280000, True))
+    alternative_factor, native_factor = to_alternative_native_ints_pair(
+            strategies.to_huge_int(2, 150000, False))
+
+    alternative_result = alternative_gcd(
+            alternative_first * alternative_factor,
+            alternative_second * alternative_factor)
+    native_result = native_gcd(native_first * native_factor,
+                               native_second * native_factor)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+@given(strategies.ints_pairs_lists)
+def test_many(pairs: List[AlternativeNativeIntsPair]) -> None:
+    alternative_values = [alternative for alternative, _ in pairs]
+    native_values = [native for _, native in pairs]
+
+    alternative_result = alternative_gcd(*alternative_values)
+    native_result = native_gcd(*native_values)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
@@ -9,3 +9,10 @@ def test_basic(pair: AlternativeNativeIntsPair) -> None:
     alternative, native = pair
 
     assert hash(alternative) == hash(native)
+
+
+@given(strategies.large_ints_pairs)
+def test_large(pair: AlternativeNativeIntsPair) -> None:
+    alternative, native = pair
+
+    assert hash(alternative) == hash(native)
@@ -22,6 +22,16 @@ def test_decimal_string(string: str) -> None:
     assert are_alternative_native_ints_equal(alternative, native)
 
 
+@given(strategies.large_ints_pairs)
+def test_large_decimal_string(ints_pair: AlternativeNativeIntsPair) -> None:
+    _, native_int = ints_pair
+    string = str(native_int)
+
+    alternative, native = AlternativeInt(string), NativeInt(string)
+
+    assert are_alternative_native_ints_equal(alternative, native)
+
+
 @given(strategies.ints_pairs)
 def test_idempotence(ints_pair: AlternativeNativeIntsPair) -> None:
     alternative_int, native_int = ints_pair
@@ -0,0 +1,47 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_iroot,
+                         are_alternative_native_ints_equal,
+                         native_iroot)
+from . import strategies
+
+
+@given(strategies.ints_pairs, strategies.root_degrees_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair,
+               degrees_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+    alternative_degree, native_degree = degrees_pair
+
+    try:
+        alternative_result = alternative_iroot(alternative_value,
+                                               alternative_degree)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_iroot(native_value, native_degree)
+    else:
+        native_result = native_iroot(native_value, native_degree)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
+
+
+@given(strategies.ints_pairs, strategies.root_degrees_pairs)
+def test_power(bases_pair: AlternativeNativeIntsPair,
+               degrees_pair: AlternativeNativeIntsPair) -> None:
+    alternative_base, native_base = bases_pair
+    alternative_degree, native_degree = degrees_pair
+
+    try:
+        alternative_result = alternative_iroot(
+                alternative_base ** alternative_degree, alternative_degree)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_iroot(native_base ** native_degree, native_degree)
+    else:
+        native_result = native_iroot(native_base ** native_degree,
+                                     native_degree)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
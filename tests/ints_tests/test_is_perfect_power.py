@@ -0,0 +1,48 @@
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_is_perfect_power,
+                         equivalence,
+                         native_is_perfect_power)
+from . import strategies
+
+
+@given(strategies.ints_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+
+    assert equivalence(alternative_is_perfect_power(alternative_value),
+                       native_is_perfect_power(native_value))
+
+
+@given(strategies.ints_pairs, strategies.root_degrees_pairs)
+def test_power(bases_pair: AlternativeNativeIntsPair,
+               degrees_pair: AlternativeNativeIntsPair) -> None:
+    alternative_base, native_base = bases_pair
+    alternative_degree, native_degree = degrees_pair
+
+    assert equivalence(
+            alternative_is_perfect_power(alternative_base
+                                         ** alternative_degree),
+            native_is_perfect_power(native_base ** native_degree))
+
+
+@given(strategies.large_ints_pairs, strategies.small_root_degrees_pairs)
+def test_large_power(bases_pair: AlternativeNativeIntsPair,
+                     degrees_pair: AlternativeNativeIntsPair) -> None:
+    alternative_base, _ = bases_pair
+    alternative_degree, _ = degrees_pair
+
+    assert alternative_is_perfect_power(alternative_base
+                                        ** alternative_degree)
+
+
+@given(strategies.large_ints_pairs, strategies.small_root_degrees_pairs)
+def test_large_power_successor(bases_pair: AlternativeNativeIntsPair,
+                               degrees_pair: AlternativeNativeIntsPair
+                               ) -> None:
+    alternative_base, _ = bases_pair
+    alternative_degree, _ = degrees_pair
+
+    assert not alternative_is_perfect_power(alternative_base
+                                            ** alternative_degree + 1)
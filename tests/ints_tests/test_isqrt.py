@@ -0,0 +1,34 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_isqrt,
+                         are_alternative_native_ints_equal,
+                         native_isqrt)
+from . import strategies
+
+
+@given(strategies.ints_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+
+    try:
+        alternative_result = alternative_isqrt(alternative_value)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_isqrt(native_value)
+    else:
+        native_result = native_isqrt(native_value)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
+
+
+@given(strategies.large_ints_pairs)
+def test_large(values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+
+    alternative_result = alternative_isqrt(abs(alternative_value))
+    native_result = native_isqrt(abs(native_value))
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
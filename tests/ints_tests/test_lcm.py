@@ -0,0 +1,32 @@
+from typing import List
+
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_lcm,
+                         are_alternative_native_ints_equal,
+                         native_lcm)
+from . import strategies
+
+
+@given(strategies.ints_pairs, strategies.ints_pairs)
+def test_basic(firsts_pair: AlternativeNativeIntsPair,
+               seconds_pair: AlternativeNativeIntsPair) -> None:
+    alternative_first, native_first = firsts_pair
+    alternative_second, native_second = seconds_pair
+
+    alternative_result = alternative_lcm(alternative_first, alternative_second)
+    native_result = native_lcm(native_first, native_second)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.ints_pairs_lists)
+def test_many(pairs: List[AlternativeNativeIntsPair]) -> None:
+    alternative_values = [alternative for alternative, _ in pairs]
+    native_values = [native for _, native in pairs]
+
+    alternative_result = alternative_lcm(*alternative_values)
+    native_result = native_lcm(*native_values)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
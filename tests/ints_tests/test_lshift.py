@@ -22,3 +22,19 @@ def test_basic(bases_pair: AlternativeNativeIntsPair,
 
         assert are_alternative_native_ints_equal(alternative_result,
                                                  native_result)
+
+
+@given(strategies.ints_pairs, strategies.single_byte_ints)
+def test_machine_int(bases_pair: AlternativeNativeIntsPair, step: int) -> None:
+    alternative_base, native_base = bases_pair
+
+    try:
+        alternative_result = alternative_base << step
+    except (MemoryError, OverflowError, ValueError) as error:
+        with pytest.raises(type(error)):
+            native_base << step
+    else:
+        native_result = native_base << step
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
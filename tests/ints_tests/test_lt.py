@@ -13,3 +13,19 @@ def test_basic(first_pair: AlternativeNativeIntsPair,
 
     assert equivalence(alternative_first < alternative_second,
                        native_first < native_second)
+
+
+@given(strategies.ints_pairs, strategies.machine_ints)
+def test_machine_int(first_pair: AlternativeNativeIntsPair,
+                     second: int) -> None:
+    alternative_first, native_first = first_pair
+
+    assert equivalence(alternative_first < second, native_first < second)
+
+
+@given(strategies.machine_ints, strategies.ints_pairs)
+def test_reflected_machine_int(first: int,
+                               second_pair: AlternativeNativeIntsPair) -> None:
+    alternative_second, native_second = second_pair
+
+    assert equivalence(first < alternative_second, first < native_second)
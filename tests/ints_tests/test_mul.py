@@ -1,7 +1,8 @@
 from hypothesis import given
 
 from tests.utils import (AlternativeNativeIntsPair,
-                         are_alternative_native_ints_equal)
+                         are_alternative_native_ints_equal,
+                         to_alternative_native_ints_pair)
 from . import strategies
 
 
@@ -15,3 +16,69 @@ def test_basic(first_pair: AlternativeNativeIntsPair,
     native_result = native_first * native_second
 
     assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.huge_ints_pairs, strategies.huge_ints_pairs)
+def test_huge(first_pair: AlternativeNativeIntsPair,
+              second_pair: AlternativeNativeIntsPair) -> None:
+    alternative_first, native_first = first_pair
+    alternative_second, native_second = second_pair
+
+    alternative_result = alternative_first * alternative_second
+    native_result = native_first * native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.huge_ints_pairs)
+def test_huge_square(pair: AlternativeNativeIntsPair) -> None:
+    alternative, native = pair
+
+    alternative_result = alternative * alternative
+    native_result = native * native
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+
+def test_number_theoretic() -> None:
+    alternative_first, native_first = to_alternative_native_ints_pair(
+            strategies.to_huge_int(0, 2200000, False))
+    alternative_second, native_second = to_alternative_native_ints_pair(
+            strategies.to_huge_int(1, 2150000, True))
+
+    alternative_result = alternative_first * alternative_second
+    native_result = native_first * native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+def test_number_theoretic_square() -> None:
+    alternative, native = to_alternative_native_ints_pair(
+            strategies.to_huge_int(2, 2200000, True))
+
+    alternative_result = alternative * alternative
+    native_result = native * native
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+@given(strategies.ints_pairs, strategies.machine_ints)
+def test_machine_int(first_pair: AlternativeNativeIntsPair,
+                     second: int) -> None:
+    alternative_first, native_first = first_pair
+
+    alternative_result = alternative_first * second
+    native_result = native_first * second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.machine_ints, strategies.ints_pairs)
+def test_reflected_machine_int(first: int,
+                               second_pair: AlternativeNativeIntsPair) -> None:
+    alternative_second, native_second = second_pair
+
+    alternative_result = first * alternative_second
+    native_result = first * native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
@@ -0,0 +1,69 @@
+from typing import List
+
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_multi_pow,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.ints_pairs_lists, strategies.ints_pairs_lists,
+       strategies.non_zero_ints_pairs)
+def test_basic(bases_pairs: List[AlternativeNativeIntsPair],
+               exponents_pairs: List[AlternativeNativeIntsPair],
+               moduli_pair: AlternativeNativeIntsPair) -> None:
+    exponents_pairs = exponents_pairs[:len(bases_pairs)]
+    bases_pairs = bases_pairs[:len(exponents_pairs)]
+    alternative_bases = [alternative for alternative, _ in bases_pairs]
+    native_bases = [native for _, native in bases_pairs]
+    alternative_exponents = [alternative for alternative, _ in exponents_pairs]
+    native_exponents = [native for _, native in exponents_pairs]
+    alternative_modulus, native_modulus = moduli_pair
+
+    try:
+        alternative_result = alternative_multi_pow(
+                alternative_bases, alternative_exponents, alternative_modulus)
+    except ValueError:
+        with pytest.raises(ValueError):
+            for base, exponent in zip(native_bases, native_exponents):
+                pow(base, exponent, native_modulus)
+    else:
+        native_result = 1 % native_modulus
+        for base, exponent in zip(native_bases, native_exponents):
+            native_result = (native_result * pow(base, exponent,
+                                                 native_modulus)
+                             % native_modulus)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
+
+
+@given(strategies.ints_pairs_lists, strategies.ints_pairs_lists,
+       strategies.non_zero_ints_pairs)
+def test_native_values(bases_pairs: List[AlternativeNativeIntsPair],
+                       exponents_pairs: List[AlternativeNativeIntsPair],
+                       moduli_pair: AlternativeNativeIntsPair) -> None:
+    exponents_pairs = exponents_pairs[:len(bases_pairs)]
+    bases_pairs = bases_pairs[:len(exponents_pairs)]
+    native_bases = [native for _, native in bases_pairs]
+    native_exponents = [native for _, native in exponents_pairs]
+    alternative_modulus, native_modulus = moduli_pair
+
+    try:
+        alternative_result = alternative_multi_pow(
+                native_bases, native_exponents, alternative_modulus)
+    except ValueError:
+        with pytest.raises(ValueError):
+            for base, exponent in zip(native_bases, native_exponents):
+                pow(base, exponent, native_modulus)
+    else:
+        native_result = 1 % native_modulus
+        for base, exponent in zip(native_bases, native_exponents):
+            native_result = (native_result * pow(base, exponent,
+                                                 native_modulus)
+                             % native_modulus)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
@@ -0,0 +1,43 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_perm,
+                         are_alternative_native_ints_equal,
+                         native_perm)
+from . import strategies
+
+
+@given(strategies.small_ints_pairs, strategies.small_ints_pairs)
+def test_basic(values_pair: AlternativeNativeIntsPair,
+               counts_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+    alternative_count, native_count = counts_pair
+
+    try:
+        alternative_result = alternative_perm(alternative_value,
+                                              alternative_count)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_perm(native_value, native_count)
+    else:
+        native_result = native_perm(native_value, native_count)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
+
+
+@given(strategies.small_ints_pairs)
+def test_full(values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_value, native_value = values_pair
+
+    try:
+        alternative_result = alternative_perm(alternative_value)
+    except ValueError:
+        with pytest.raises(ValueError):
+            native_perm(native_value)
+    else:
+        native_result = native_perm(native_value)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
@@ -0,0 +1,62 @@
+from typing import List
+
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_pow_many,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.ints_pairs_lists, strategies.ints_pairs,
+       strategies.non_zero_ints_pairs)
+def test_basic(bases_pairs: List[AlternativeNativeIntsPair],
+               exponents_pair: AlternativeNativeIntsPair,
+               moduli_pair: AlternativeNativeIntsPair) -> None:
+    alternative_bases = [alternative for alternative, _ in bases_pairs]
+    native_bases = [native for _, native in bases_pairs]
+    alternative_exponent, native_exponent = exponents_pair
+    alternative_modulus, native_modulus = moduli_pair
+
+    try:
+        alternative_results = alternative_pow_many(
+                alternative_bases, alternative_exponent, alternative_modulus)
+    except ValueError:
+        with pytest.raises(ValueError):
+            for base in native_bases:
+                pow(base, native_exponent, native_modulus)
+    else:
+        native_results = [pow(base, native_exponent, native_modulus)
+                          for base in native_bases]
+
+        assert len(alternative_results) == len(native_results)
+        assert all(are_alternative_native_ints_equal(alternative, native)
+                   for alternative, native in zip(alternative_results,
+                                                  native_results))
+
+
+@given(strategies.ints_pairs_lists, strategies.ints_pairs,
+       strategies.non_zero_ints_pairs)
+def test_native_values(bases_pairs: List[AlternativeNativeIntsPair],
+                       exponents_pair: AlternativeNativeIntsPair,
+                       moduli_pair: AlternativeNativeIntsPair) -> None:
+    native_bases = [native for _, native in bases_pairs]
+    alternative_exponent, native_exponent = exponents_pair
+    alternative_modulus, native_modulus = moduli_pair
+
+    try:
+        alternative_results = alternative_pow_many(
+                native_bases, alternative_exponent, alternative_modulus)
+    except ValueError:
+        with pytest.raises(ValueError):
+            for base in native_bases:
+                pow(base, native_exponent, native_modulus)
+    else:
+        native_results = [pow(base, native_exponent, native_modulus)
+                          for base in native_bases]
+
+        assert len(alternative_results) == len(native_results)
+        assert all(are_alternative_native_ints_equal(alternative, native)
+                   for alternative, native in zip(alternative_results,
+                                                  native_results))
@@ -1,7 +1,8 @@
 from hypothesis import given
 
 from tests.utils import (AlternativeNativeIntsPair,
-                         are_alternative_native_ints_equal)
+                         are_alternative_native_ints_equal,
+                         to_alternative_native_ints_pair)
 from . import strategies
 
 
@@ -15,3 +16,58 @@ def test_basic(minuends_pair: AlternativeNativeIntsPair,
     native_result = native_minuend - native_subtrahend
 
     assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+
+@given(strategies.large_ints_pairs)
+def test_borrow_chain(pair: AlternativeNativeIntsPair) -> None:
+    _, native = pair
+    native_subtrahend = abs(native) << abs(native).bit_length()
+    native_minuend = native_subtrahend - 1
+    alternative_minuend, native_minuend = to_alternative_native_ints_pair(
+            native_minuend)
+    alternative_subtrahend, native_subtrahend = (
+            to_alternative_native_ints_pair(native_subtrahend))
+
+    alternative_result = alternative_minuend - alternative_subtrahend
+    native_result = native_minuend - native_subtrahend
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.large_ints_pairs)
+def test_borrow_chain_through_zeros(pair: AlternativeNativeIntsPair) -> None:
+    _, native = pair
+    shift = abs(native).bit_length()
+    native_minuend = abs(native) << shift
+    native_subtrahend = native_minuend - (1 << shift) + 1
+    alternative_minuend, native_minuend = to_alternative_native_ints_pair(
+            native_minuend)
+    alternative_subtrahend, native_subtrahend = (
+            to_alternative_native_ints_pair(native_subtrahend))
+
+    alternative_result = alternative_minuend - alternative_subtrahend
+    native_result = native_minuend - native_subtrahend
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+@given(strategies.ints_pairs, strategies.machine_ints)
+def test_machine_int(first_pair: AlternativeNativeIntsPair,
+                     second: int) -> None:
+    alternative_first, native_first = first_pair
+
+    alternative_result = alternative_first - second
+    native_result = native_first - second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.machine_ints, strategies.ints_pairs)
+def test_reflected_machine_int(first: int,
+                               second_pair: AlternativeNativeIntsPair) -> None:
+    alternative_second, native_second = second_pair
+
+    alternative_result = first - alternative_second
+    native_result = first - native_second
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
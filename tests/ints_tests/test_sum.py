@@ -0,0 +1,44 @@
+from typing import List
+
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_sum,
+                         are_alternative_native_ints_equal,
+                         native_sum)
+from . import strategies
+
+
+@given(strategies.ints_pairs_lists)
+def test_basic(pairs: List[AlternativeNativeIntsPair]) -> None:
+    alternative_values = [alternative for alternative, _ in pairs]
+    native_values = [native for _, native in pairs]
+
+    alternative_result = alternative_sum(alternative_values)
+    native_result = native_sum(native_values)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.ints_pairs_lists)
+def test_native_values(pairs: List[AlternativeNativeIntsPair]) -> None:
+    native_values = [native for _, native in pairs]
+
+    alternative_result = alternative_sum(iter(native_values))
+    native_result = native_sum(native_values)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
+
+
+@given(strategies.ints_pairs_lists, strategies.ints_pairs)
+def test_start(pairs: List[AlternativeNativeIntsPair],
+               starts_pair: AlternativeNativeIntsPair) -> None:
+    alternative_values = [alternative for alternative, _ in pairs]
+    native_values = [native for _, native in pairs]
+    alternative_start, native_start = starts_pair
+
+    alternative_result = alternative_sum(alternative_values,
+                                          start=alternative_start)
+    native_result = native_sum(native_values, start=native_start)
+
+    assert are_alternative_native_ints_equal(alternative_result, native_result)
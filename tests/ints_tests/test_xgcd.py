@@ -0,0 +1,64 @@
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         alternative_xgcd,
+                         are_alternative_native_ints_equal,
+                         native_gcd,
+                         to_alternative_native_ints_pair)
+from . import strategies
+
+
+@given(strategies.ints_pairs, strategies.ints_pairs)
+def test_basic(firsts_pair: AlternativeNativeIntsPair,
+               seconds_pair: AlternativeNativeIntsPair) -> None:
+    alternative_first, native_first = firsts_pair
+    alternative_second, native_second = seconds_pair
+
+    result, first_coefficient, second_coefficient = alternative_xgcd(
+            alternative_first, alternative_second)
+
+    assert are_alternative_native_ints_equal(
+            result, native_gcd(native_first, native_second))
+    assert (first_coefficient * alternative_first
+            + second_coefficient * alternative_second) == result
+    assert (0 <= first_coefficient < abs(alternative_second) // result
+            if alternative_second
+            else (first_coefficient
+                  == (alternative_first > 0) - (alternative_first < 0)
+                  and second_coefficient == 0))
+
+
+@given(strategies.large_ints_pairs, strategies.large_ints_pairs)
+def test_large(firsts_pair: AlternativeNativeIntsPair,
+               seconds_pair: AlternativeNativeIntsPair) -> None:
+    alternative_first, native_first = firsts_pair
+    alternative_second, native_second = seconds_pair
+
+    result, first_coefficient, second_coefficient = alternative_xgcd(
+            alternative_first, alternative_second)
+
+    assert are_alternative_native_ints_equal(
+            result, native_gcd(native_first, native_second))
+    assert (first_coefficient * alternative_first
+            + second_coefficient * alternative_second) == result
+
+
+def test_half_gcd() -> None:
+    alternative_first, native_first = to_alternative_native_ints_pair(
+            strategies.to_huge_int(0, 300000, False))
+    alternative_second, native_second = to_alternative_native_ints_pair(
+            strategies.to_huge_int(1, 280000, True))
+    alternative_factor, native_factor = to_alternative_native_ints_pair(
+            strategies.to_huge_int(2, 150000, False))
+    alternative_first *= alternative_factor
+    alternative_second *= alternative_factor
+
+    result, first_coefficient, second_coefficient = alternative_xgcd(
+            alternative_first, alternative_second)
+
+    assert are_alternative_native_ints_equal(
+            result, native_gcd(native_first * native_factor,
+                               native_second * native_factor))
+    assert (first_coefficient * alternative_first
+            + second_coefficient * alternative_second) == result
+    assert 0 <= first_coefficient < abs(alternative_second) // result
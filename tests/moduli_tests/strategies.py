@@ -0,0 +1,26 @@
+from random import Random
+
+from hypothesis import strategies
+
+from tests.utils import (to_alternative_native_ints_pair,
+                         to_alternative_native_moduli_pair)
+
+
+def to_large_int(seed: int, bit_length: int, negative: bool) -> int:
+    result = Random(seed).getrandbits(bit_length) | 1 << (bit_length - 1)
+    return -result if negative else result
+
+
+large_ints = strategies.builds(to_large_int, strategies.integers(),
+                               strategies.integers(1000, 20000),
+                               strategies.booleans())
+ints = strategies.integers() | large_ints
+ints_pairs = ints.map(to_alternative_native_ints_pair)
+exponents_pairs = (strategies.integers(-1000, 1000)
+                   .map(to_alternative_native_ints_pair))
+large_moduli_pairs = (strategies.builds(to_large_int, strategies.integers(),
+                                         strategies.integers(4000, 20000),
+                                         strategies.booleans())
+                      .map(to_alternative_native_moduli_pair))
+moduli_pairs = (ints.filter(bool)
+                .map(to_alternative_native_moduli_pair))
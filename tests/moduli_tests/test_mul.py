@@ -0,0 +1,22 @@
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         AlternativeNativeModuliPair,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.moduli_pairs, strategies.ints_pairs, strategies.ints_pairs)
+def test_basic(moduli_pair: AlternativeNativeModuliPair,
+               firsts_pair: AlternativeNativeIntsPair,
+               seconds_pair: AlternativeNativeIntsPair) -> None:
+    alternative_modulus, native_modulus = moduli_pair
+    alternative_first, native_first = firsts_pair
+    alternative_second, native_second = seconds_pair
+
+    alternative_result = alternative_modulus.mul(alternative_first,
+                                                 alternative_second)
+    native_result = native_first * native_second % native_modulus
+
+    assert are_alternative_native_ints_equal(alternative_result,
+                                             native_result)
@@ -0,0 +1,29 @@
+import pytest
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         AlternativeNativeModuliPair,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.moduli_pairs, strategies.ints_pairs,
+       strategies.exponents_pairs)
+def test_basic(moduli_pair: AlternativeNativeModuliPair,
+               bases_pair: AlternativeNativeIntsPair,
+               exponents_pair: AlternativeNativeIntsPair) -> None:
+    alternative_modulus, native_modulus = moduli_pair
+    alternative_base, native_base = bases_pair
+    alternative_exponent, native_exponent = exponents_pair
+
+    try:
+        alternative_result = alternative_modulus.pow(alternative_base,
+                                                     alternative_exponent)
+    except ValueError:
+        with pytest.raises(ValueError):
+            pow(native_base, native_exponent, native_modulus)
+    else:
+        native_result = pow(native_base, native_exponent, native_modulus)
+
+        assert are_alternative_native_ints_equal(alternative_result,
+                                                 native_result)
@@ -0,0 +1,38 @@
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         AlternativeNativeModuliPair,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.moduli_pairs, strategies.ints_pairs)
+def test_basic(moduli_pair: AlternativeNativeModuliPair,
+               values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_modulus, native_modulus = moduli_pair
+    alternative_value, native_value = values_pair
+
+    alternative_result = alternative_modulus.reduce(alternative_value)
+    native_result = native_value % native_modulus
+
+    assert are_alternative_native_ints_equal(alternative_result,
+                                             native_result)
+
+
+@given(strategies.large_moduli_pairs, strategies.ints_pairs,
+       strategies.ints_pairs)
+def test_large(moduli_pair: AlternativeNativeModuliPair,
+               quotients_pair: AlternativeNativeIntsPair,
+               remainders_pair: AlternativeNativeIntsPair) -> None:
+    alternative_modulus, native_modulus = moduli_pair
+    alternative_quotient, native_quotient = quotients_pair
+    alternative_remainder, native_remainder = remainders_pair
+
+    alternative_result = alternative_modulus.reduce(
+            alternative_quotient * alternative_modulus.value
+            + alternative_remainder)
+    native_result = ((native_quotient * native_modulus + native_remainder)
+                     % native_modulus)
+
+    assert are_alternative_native_ints_equal(alternative_result,
+                                             native_result)
@@ -0,0 +1,19 @@
+from hypothesis import given
+
+from tests.utils import (AlternativeNativeIntsPair,
+                         AlternativeNativeModuliPair,
+                         are_alternative_native_ints_equal)
+from . import strategies
+
+
+@given(strategies.moduli_pairs, strategies.ints_pairs)
+def test_basic(moduli_pair: AlternativeNativeModuliPair,
+               values_pair: AlternativeNativeIntsPair) -> None:
+    alternative_modulus, native_modulus = moduli_pair
+    alternative_value, native_value = values_pair
+
+    alternative_result = alternative_modulus.square(alternative_value)
+    native_result = native_value * native_value % native_modulus
+
+    assert are_alternative_native_ints_equal(alternative_result,
+                                             native_result)
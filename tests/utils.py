@@ -2,10 +2,13 @@ import builtins
 import fractions
 import math
 import pickle
+from functools import reduce
 from itertools import zip_longest
-from operator import eq
+from operator import (eq,
+                      mul)
 from typing import (Any,
                     Hashable,
+                    Iterable,
                     Iterator,
                     List,
                     Optional,
@@ -21,6 +24,7 @@ Strategy = Strategy
 AlternativeFraction = cppbuiltins.Fraction
 AlternativeInt = cppbuiltins.int
 AlternativeList = cppbuiltins.list
+AlternativeModulus = cppbuiltins.Modulus
 AlternativeSet = cppbuiltins.set
 NativeFraction = fractions.Fraction
 NativeInt = builtins.int
@@ -28,11 +32,26 @@ NativeList = builtins.list
 NativeSet = builtins.set
 AlternativeNativeFractionsPair = Tuple[AlternativeFraction, NativeFraction]
 AlternativeNativeIntsPair = Tuple[AlternativeInt, NativeInt]
+AlternativeNativeModuliPair = Tuple[AlternativeModulus, NativeInt]
 AlternativeNativeListsPair = Tuple[AlternativeList, NativeList]
 AlternativeNativeSetsPair = Tuple[AlternativeSet, NativeSet]
 
+alternative_comb = cppbuiltins.comb
+alternative_factorial = cppbuiltins.factorial
 alternative_gcd = cppbuiltins.gcd
+alternative_iroot = cppbuiltins.iroot
+alternative_is_perfect_power = cppbuiltins.is_perfect_power
+alternative_isqrt = cppbuiltins.isqrt
+alternative_lcm = cppbuiltins.lcm
+alternative_multi_pow = cppbuiltins.multi_pow
+alternative_perm = cppbuiltins.perm
+alternative_pow_many = cppbuiltins.pow_many
+alternative_prod = cppbuiltins.prod
+alternative_sum = cppbuiltins.sum
+alternative_xgcd = cppbuiltins.xgcd
+native_factorial = math.factorial
 native_gcd = math.gcd
+native_sum = builtins.sum
 
 
 def are_iterators_equal(left: Iterator[Any],
@@ -74,6 +93,77 @@ def equivalence(left: bool, right: bool) -> bool:
     return left is right
 
 
+def native_comb(value: NativeInt, count: NativeInt) -> NativeInt:
+    if value < 0 or count < 0:
+        raise ValueError('Both value and count should be non-negative.')
+    if count > value:
+        return 0
+    count = min(count, value - count)
+    return native_perm(value, count) // native_factorial(count)
+
+
+def native_iroot(value: NativeInt, degree: NativeInt) -> NativeInt:
+    if degree <= 0 or value < 0 and not degree % 2:
+        raise ValueError('Root is undefined.')
+    if value < 0:
+        return -native_iroot(-value, degree)
+    if not value:
+        return value
+    result = 1 << -(-value.bit_length() // degree)
+    while True:
+        candidate = (((degree - 1) * result + value // result ** (degree - 1))
+                     // degree)
+        if candidate >= result:
+            return result
+        result = candidate
+
+
+def native_isqrt(value: NativeInt) -> NativeInt:
+    if value < 0:
+        raise ValueError('Square root of negative number is undefined.')
+    if not value:
+        return value
+    result = 1 << -(-value.bit_length() // 2)
+    while True:
+        candidate = (result + value // result) // 2
+        if candidate >= result:
+            return result
+        result = candidate
+
+
+def native_is_perfect_power(value: NativeInt) -> bool:
+    modulus = abs(value)
+    return modulus <= 1 or any(
+            native_iroot(value, degree) ** degree == value
+            for degree in range(2 + (value < 0), modulus.bit_length(),
+                                1 + (value < 0)))
+
+
+def native_lcm(*values: NativeInt) -> NativeInt:
+    return reduce(lambda first, second: (abs(first * second)
+                                         // native_gcd(first, second)
+                                         if first and second
+                                         else 0),
+                  values, 1)
+
+
+def native_perm(value: NativeInt,
+                count: Optional[NativeInt] = None) -> NativeInt:
+    if count is None:
+        count = value
+    if value < 0 or count < 0:
+        raise ValueError('Both value and count should be non-negative.')
+    if count > value:
+        return 0
+    return reduce(mul, range(value - count + 1, value + 1), 1)
+
+
+def native_prod(values: Iterable[NativeInt],
+                *,
+                start: NativeInt = 1) -> NativeInt:
+    return reduce(mul, values, start)
+
+
 def pickle_round_trip(value: Domain) -> Domain:
     return pickle.loads(pickle.dumps(value))
 
@@ -98,6 +188,11 @@ def to_alternative_native_ints_pair(native: int) -> AlternativeNativeIntsPair:
     return AlternativeInt(native), native
 
 
+def to_alternative_native_moduli_pair(native: int
+                                      ) -> AlternativeNativeModuliPair:
+    return AlternativeModulus(AlternativeInt(native)), native
+
+
 def to_alternative_native_lists_pair(values: List[Any]
                                      ) -> AlternativeNativeListsPair:
     return AlternativeList(values), NativeList(values)